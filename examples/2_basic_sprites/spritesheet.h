@@ -1,61 +1,61 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-constexpr uint8_t spritesheetWidth = 16;
-constexpr uint8_t spritesheetHeight = 16;
-
-constexpr uint8_t spritesheet[] PROGMEM
-{
-  //Frame 0
-  0x00, 0x00, 0x60, 0x3C, 0xCE, 0x7C, 0x3E, 0x7E, 0x5C, 0x3E, 0x6E, 0x3C, 0x60, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x60, 0x61, 0x63, 0x6E, 0x60, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 1
-  0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 
-  0x01, 0x08, 0x00, 0x08, 0x00, 0x07, 0x10, 0x00, 0x10, 0x07, 0x00, 0x08, 0x00, 0x08, 0x01, 0x00, 
-
-  //Frame 2
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x40, 0x20, 0x30, 0x50, 0x60, 0x40, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 3
-  0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x0B, 0x15, 0x5B, 0x55, 0x5B, 0x55, 0x1B, 0x05, 0x01, 0x00, 0x00, 0x00, 
-
-  //Frame 4
-  0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
-
-  //Frame 5
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-constexpr uint8_t spritesheet_Mask[] PROGMEM
-{
-  //Mask Frame 0
-  0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0x01, 0x10, 0x79, 0xF9, 0xFB, 0xFF, 0xFF, 0xFE, 0xF8, 0x78, 0x11, 0x00, 0x00, 0x00, 
-
-  //Mask Frame 1
-  0xC0, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0x00, 0xF0, 0xF0, 0x00, 0xC0, 0xC0, 0x00, 
-  0x03, 0x1F, 0x04, 0x1F, 0x04, 0x0F, 0x3E, 0x03, 0x3E, 0x0F, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x00, 
-
-  //Mask Frame 2
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 
-
-  //Mask Frame 3
-  0x20, 0x58, 0xE8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xE8, 0x58, 0x20, 
-  0x00, 0x00, 0x03, 0x1F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x1F, 0x03, 0x00, 0x00, 
-
-  //Mask Frame 4
-  0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 
-  0x00, 0x01, 0x01, 0x03, 0x03, 0x83, 0xC3, 0xFF, 0xFF, 0xC3, 0x83, 0x03, 0x03, 0x01, 0x01, 0x00, 
-
-  //Mask Frame 5
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+constexpr uint8_t spritesheetWidth = 16;
+constexpr uint8_t spritesheetHeight = 16;
+
+constexpr uint8_t spritesheet[] PROGMEM
+{
+  //Frame 0
+  0x00, 0x00, 0x60, 0x3C, 0xCE, 0x7C, 0x3E, 0x7E, 0x5C, 0x3E, 0x6E, 0x3C, 0x60, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x60, 0x61, 0x63, 0x6E, 0x60, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 1
+  0xC0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0x00, 
+  0x01, 0x08, 0x00, 0x08, 0x00, 0x07, 0x10, 0x00, 0x10, 0x07, 0x00, 0x08, 0x00, 0x08, 0x01, 0x00, 
+
+  //Frame 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x40, 0x20, 0x30, 0x50, 0x60, 0x40, 0x00, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 3
+  0x00, 0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x80, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x0B, 0x15, 0x5B, 0x55, 0x5B, 0x55, 0x1B, 0x05, 0x01, 0x00, 0x00, 0x00, 
+
+  //Frame 4
+  0x00, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 
+
+  //Frame 5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t spritesheet_Mask[] PROGMEM
+{
+  //Mask Frame 0
+  0x00, 0xE0, 0xFC, 0xFE, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x10, 0x79, 0xF9, 0xFB, 0xFF, 0xFF, 0xFE, 0xF8, 0x78, 0x11, 0x00, 0x00, 0x00, 
+
+  //Mask Frame 1
+  0xC0, 0xC0, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xFF, 0x01, 0x00, 0xF0, 0xF0, 0x00, 0xC0, 0xC0, 0x00, 
+  0x03, 0x1F, 0x04, 0x1F, 0x04, 0x0F, 0x3E, 0x03, 0x3E, 0x0F, 0x04, 0x1F, 0x04, 0x1F, 0x03, 0x00, 
+
+  //Mask Frame 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0xC0, 0xE0, 0xF0, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF0, 0xE0, 0xE0, 0xE0, 0xC0, 0x00, 0x00, 
+
+  //Mask Frame 3
+  0x20, 0x58, 0xE8, 0xF8, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF0, 0xF8, 0xE8, 0x58, 0x20, 
+  0x00, 0x00, 0x03, 0x1F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x1F, 0x03, 0x00, 0x00, 
+
+  //Mask Frame 4
+  0x80, 0xC0, 0xC0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 
+  0x00, 0x01, 0x01, 0x03, 0x03, 0x83, 0xC3, 0xFF, 0xFF, 0xC3, 0x83, 0x03, 0x03, 0x01, 0x01, 0x00, 
+
+  //Mask Frame 5
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
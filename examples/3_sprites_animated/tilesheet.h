@@ -1,51 +1,51 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-constexpr uint8_t tilesheetWidth = 16;
-constexpr uint8_t tilesheetHeight = 16;
-
-// NOTE: you must remove the width/height from generated output!
-constexpr uint8_t tilesheet[] PROGMEM
-{
-  //Frame 0
-  0xFF, 0x7F, 0x8F, 0xF3, 0xF9, 0xFC, 0xFD, 0xFD, 0xFD, 0xFB, 0xF3, 0xED, 0xDE, 0x3F, 0x7F, 0xFF, 
-  0xF0, 0xEF, 0xDF, 0x9F, 0x1F, 0xEF, 0xF7, 0xFB, 0xFB, 0xFB, 0xF7, 0xC7, 0x33, 0xF8, 0xFE, 0xFE, 
-
-  //Frame 1
-  0x07, 0xFB, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFB, 0xF7, 0x0F, 0xEF, 0xF6, 0xF8, 0xFB, 0xF7, 
-  0xDE, 0xCD, 0xB3, 0x7B, 0xFB, 0xFF, 0xF7, 0x77, 0xA7, 0x9B, 0xBC, 0x7E, 0x7D, 0x7D, 0x7D, 0xBE, 
-
-  //Frame 2
-  0x07, 0xC3, 0xE1, 0xE0, 0xE3, 0xE7, 0xE7, 0xE7, 0xC7, 0x9B, 0x3D, 0x7C, 0xFC, 0xF9, 0x73, 0x07, 
-  0xDC, 0xDC, 0x9D, 0x3D, 0x3D, 0x99, 0xC1, 0xE3, 0xE3, 0xE1, 0xE0, 0xC0, 0x0C, 0x1E, 0x9E, 0xDC, 
-
-  //Frame 3
-  0xC3, 0xCD, 0xCC, 0x81, 0x3B, 0xBB, 0xDB, 0xC3, 0xC3, 0xBD, 0x7E, 0x7E, 0x7E, 0x7E, 0xBD, 0xC3, 
-  0xCF, 0x8F, 0x0F, 0xE7, 0xF0, 0xF3, 0xF7, 0xF7, 0xF7, 0xE3, 0x0C, 0x6C, 0x60, 0x00, 0x97, 0xCF, 
-
-  //Frame 4
-  0x0C, 0x60, 0x70, 0x3C, 0x9E, 0xDF, 0xDF, 0xCE, 0xC0, 0x9E, 0x3F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1E, 
-  0x38, 0x7C, 0xFE, 0xFE, 0x7C, 0x39, 0x03, 0x03, 0x33, 0x79, 0x7C, 0xBE, 0x9E, 0x9E, 0x0C, 0x00, 
-
-  //Frame 5
-  0xF3, 0xF1, 0xF0, 0xE6, 0xCE, 0x0F, 0xF7, 0xBB, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xE4, 0xF9, 0x03, 
-  0xBE, 0x7D, 0x7D, 0x79, 0x78, 0x30, 0x01, 0x63, 0xD3, 0xF3, 0xFB, 0xFB, 0x7B, 0x33, 0x01, 0x9C, 
-
-  //Frame 6
-  0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 
-  0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 
-
-  //Frame 7
-  0x07, 0x73, 0xF9, 0xFC, 0x7C, 0x3D, 0x9B, 0xC7, 0xE7, 0xE7, 0xE7, 0xE3, 0xE0, 0xE1, 0xC3, 0x07, 
-  0xDC, 0x9E, 0x1E, 0x0C, 0xC0, 0xE0, 0xE1, 0xE3, 0xE3, 0xC1, 0x99, 0x3D, 0x3D, 0x9D, 0xDC, 0xDC, 
-
-  //Frame 8
-  0x77, 0xFB, 0xF8, 0xF1, 0x63, 0x03, 0x73, 0xBB, 0xFD, 0xFC, 0xFC, 0xFC, 0xF4, 0xC9, 0x73, 0x07, 
-  0x9C, 0x3C, 0x38, 0xB0, 0xC6, 0xCF, 0x8F, 0x66, 0xD0, 0xF9, 0xF9, 0xF9, 0x79, 0xB0, 0xC0, 0xCC, 
-
-  //Frame 9
-  0xF7, 0xFB, 0xF8, 0xF7, 0xED, 0x0F, 0x77, 0xBB, 0xFC, 0xFE, 0xFE, 0xFE, 0xF6, 0xCD, 0xFB, 0x07, 
-  0xBE, 0x5D, 0x79, 0xB5, 0xCE, 0xDF, 0x9F, 0x76, 0xD9, 0xFB, 0xFB, 0xFB, 0x7B, 0xB1, 0xCC, 0xDE
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+constexpr uint8_t tilesheetWidth = 16;
+constexpr uint8_t tilesheetHeight = 16;
+
+// NOTE: you must remove the width/height from generated output!
+constexpr uint8_t tilesheet[] PROGMEM
+{
+  //Frame 0
+  0xFF, 0x7F, 0x8F, 0xF3, 0xF9, 0xFC, 0xFD, 0xFD, 0xFD, 0xFB, 0xF3, 0xED, 0xDE, 0x3F, 0x7F, 0xFF, 
+  0xF0, 0xEF, 0xDF, 0x9F, 0x1F, 0xEF, 0xF7, 0xFB, 0xFB, 0xFB, 0xF7, 0xC7, 0x33, 0xF8, 0xFE, 0xFE, 
+
+  //Frame 1
+  0x07, 0xFB, 0xFD, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFB, 0xF7, 0x0F, 0xEF, 0xF6, 0xF8, 0xFB, 0xF7, 
+  0xDE, 0xCD, 0xB3, 0x7B, 0xFB, 0xFF, 0xF7, 0x77, 0xA7, 0x9B, 0xBC, 0x7E, 0x7D, 0x7D, 0x7D, 0xBE, 
+
+  //Frame 2
+  0x07, 0xC3, 0xE1, 0xE0, 0xE3, 0xE7, 0xE7, 0xE7, 0xC7, 0x9B, 0x3D, 0x7C, 0xFC, 0xF9, 0x73, 0x07, 
+  0xDC, 0xDC, 0x9D, 0x3D, 0x3D, 0x99, 0xC1, 0xE3, 0xE3, 0xE1, 0xE0, 0xC0, 0x0C, 0x1E, 0x9E, 0xDC, 
+
+  //Frame 3
+  0xC3, 0xCD, 0xCC, 0x81, 0x3B, 0xBB, 0xDB, 0xC3, 0xC3, 0xBD, 0x7E, 0x7E, 0x7E, 0x7E, 0xBD, 0xC3, 
+  0xCF, 0x8F, 0x0F, 0xE7, 0xF0, 0xF3, 0xF7, 0xF7, 0xF7, 0xE3, 0x0C, 0x6C, 0x60, 0x00, 0x97, 0xCF, 
+
+  //Frame 4
+  0x0C, 0x60, 0x70, 0x3C, 0x9E, 0xDF, 0xDF, 0xCE, 0xC0, 0x9E, 0x3F, 0x7F, 0x7F, 0x7F, 0x3F, 0x1E, 
+  0x38, 0x7C, 0xFE, 0xFE, 0x7C, 0x39, 0x03, 0x03, 0x33, 0x79, 0x7C, 0xBE, 0x9E, 0x9E, 0x0C, 0x00, 
+
+  //Frame 5
+  0xF3, 0xF1, 0xF0, 0xE6, 0xCE, 0x0F, 0xF7, 0xBB, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xE4, 0xF9, 0x03, 
+  0xBE, 0x7D, 0x7D, 0x79, 0x78, 0x30, 0x01, 0x63, 0xD3, 0xF3, 0xFB, 0xFB, 0x7B, 0x33, 0x01, 0x9C, 
+
+  //Frame 6
+  0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 
+  0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 0x7B, 0xFC, 0xFD, 0xFE, 0xFC, 0x7B, 0x9B, 0xA7, 
+
+  //Frame 7
+  0x07, 0x73, 0xF9, 0xFC, 0x7C, 0x3D, 0x9B, 0xC7, 0xE7, 0xE7, 0xE7, 0xE3, 0xE0, 0xE1, 0xC3, 0x07, 
+  0xDC, 0x9E, 0x1E, 0x0C, 0xC0, 0xE0, 0xE1, 0xE3, 0xE3, 0xC1, 0x99, 0x3D, 0x3D, 0x9D, 0xDC, 0xDC, 
+
+  //Frame 8
+  0x77, 0xFB, 0xF8, 0xF1, 0x63, 0x03, 0x73, 0xBB, 0xFD, 0xFC, 0xFC, 0xFC, 0xF4, 0xC9, 0x73, 0x07, 
+  0x9C, 0x3C, 0x38, 0xB0, 0xC6, 0xCF, 0x8F, 0x66, 0xD0, 0xF9, 0xF9, 0xF9, 0x79, 0xB0, 0xC0, 0xCC, 
+
+  //Frame 9
+  0xF7, 0xFB, 0xF8, 0xF7, 0xED, 0x0F, 0x77, 0xBB, 0xFC, 0xFE, 0xFE, 0xFE, 0xF6, 0xCD, 0xFB, 0x07, 
+  0xBE, 0x5D, 0x79, 0xB5, 0xCE, 0xDF, 0x9F, 0x76, 0xD9, 0xFB, 0xFB, 0xFB, 0x7B, 0xB1, 0xCC, 0xDE
+};
@@ -1,22 +1,22 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-constexpr uint8_t raycastBgWidth = 100;
-constexpr uint8_t raycastBgHeight = 64;
-
-constexpr uint8_t raycastBg[] PROGMEM
-{
-  //raycastBgWidth, raycastBgHeight,
-
-  //Frame 0
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 
-  0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 
-  0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+constexpr uint8_t raycastBgWidth = 100;
+constexpr uint8_t raycastBgHeight = 64;
+
+constexpr uint8_t raycastBg[] PROGMEM
+{
+  //raycastBgWidth, raycastBgHeight,
+
+  //Frame 0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 
+  0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 
+  0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40
+};
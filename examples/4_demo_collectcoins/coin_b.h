@@ -1,27 +1,27 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-constexpr uint8_t coin_bWidth = 8;
-constexpr uint8_t coin_bHeight = 8;
-
-constexpr uint8_t coin_b[] PROGMEM
-{
-  coin_bWidth, coin_bHeight,
-
-  //Frame 0
-  0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 
-
-  //Frame 1
-  0x00, 0x3C, 0x66, 0x5A, 0x5A, 0x66, 0x3C, 0x00, 
-
-  //Frame 2
-  0x00, 0x00, 0x3C, 0x66, 0x5A, 0x3C, 0x00, 0x00, 
-
-  //Frame 3
-  0x00, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 
-
-  //Frame 4
-  0x00, 0x00, 0x3C, 0x5A, 0x66, 0x3C, 0x00, 0x00
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+constexpr uint8_t coin_bWidth = 8;
+constexpr uint8_t coin_bHeight = 8;
+
+constexpr uint8_t coin_b[] PROGMEM
+{
+  coin_bWidth, coin_bHeight,
+
+  //Frame 0
+  0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 
+
+  //Frame 1
+  0x00, 0x3C, 0x66, 0x5A, 0x5A, 0x66, 0x3C, 0x00, 
+
+  //Frame 2
+  0x00, 0x00, 0x3C, 0x66, 0x5A, 0x3C, 0x00, 0x00, 
+
+  //Frame 3
+  0x00, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 
+
+  //Frame 4
+  0x00, 0x00, 0x3C, 0x5A, 0x66, 0x3C, 0x00, 0x00
+};
@@ -1,23 +1,23 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-constexpr uint8_t bg_fullWidth = 128;
-constexpr uint8_t bg_fullHeight = 64;
-
-// Generated from the bg_full.png image with Arduboy Toolset
-constexpr uint8_t bg_full[] PROGMEM
-{
-  //bg_fullWidth, bg_fullHeight,
-
-  //Frame 0
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
-  0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 
-  0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 
-  0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+constexpr uint8_t bg_fullWidth = 128;
+constexpr uint8_t bg_fullHeight = 64;
+
+// Generated from the bg_full.png image with Arduboy Toolset
+constexpr uint8_t bg_full[] PROGMEM
+{
+  //bg_fullWidth, bg_fullHeight,
+
+  //Frame 0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 
+  0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00, 0xA8, 0x00, 0x22, 0x00, 0x80, 0x00, 0x22, 0x00, 0x88, 0x00, 
+  0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xA2, 0x00, 0xAA, 0x00, 0xAA, 0x00, 0xAA, 0x00, 
+  0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x44, 0xAA, 0x11, 0xAA, 0x40, 0xAA, 0x11, 0xAA, 0x40
+};
@@ -1,162 +1,162 @@
-#pragma once
-
-#include <stdint.h>
-#include <avr/pgmspace.h>
-
-// You don't have to declare enums for your sprites but
-// it sure is nice sometimes. Also, we specifically mark it as
-// uint8_t because usually they're "int" and those are 2 bytes.
-enum MySprites : uint8_t {
-  Face = 0,
-  Unused1,
-  Unused2,
-  Unused3,
-  Monster,
-  LeverOff,
-  LeverOn,
-  Key,
-  Rock,
-  Crate,
-  Barrel,
-  Chest,
-  DeadTree,
-  Grave1,
-  Grave2
-};
-
-constexpr uint8_t spritesheetWidth = 16;
-constexpr uint8_t spritesheetHeight = 16;
-
-constexpr uint8_t spritesheet[] PROGMEM
-{
-  //Frame 0
-  0x00, 0xC0, 0x70, 0x18, 0x8C, 0x44, 0x86, 0x06, 0x06, 0x86, 0x44, 0x8C, 0x18, 0x70, 0xC0, 0x00, 
-  0x00, 0x03, 0x0E, 0x18, 0x30, 0x20, 0x62, 0x44, 0x44, 0x62, 0x20, 0x30, 0x18, 0x0E, 0x03, 0x00, 
-
-  //Frame 1
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 2
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 3
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 4
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 5
-  0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1C, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x1C, 0x00, 0x00, 0x00, 
-
-  //Frame 6
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x1C, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x1C, 0x00, 0x00, 0x00, 
-
-  //Frame 7
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 8
-  0x00, 0x00, 0x00, 0x00, 0xF0, 0xD8, 0xA8, 0x5C, 0xBC, 0x54, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x01, 0x07, 0x03, 0x06, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 9
-  0x00, 0xE0, 0x28, 0x2C, 0xAE, 0xAA, 0x2A, 0xAA, 0xAA, 0x2A, 0xEA, 0x0E, 0x56, 0x0A, 0x54, 0x00, 
-  0x00, 0x7F, 0x40, 0x5B, 0x4D, 0x56, 0x5B, 0x4D, 0x56, 0x40, 0x7F, 0x00, 0x15, 0x08, 0x05, 0x00, 
-
-  //Frame 10
-  0x00, 0x00, 0x00, 0xD0, 0xB4, 0xB4, 0x6E, 0x2E, 0x4E, 0x2E, 0x54, 0x84, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x07, 0x37, 0x2F, 0x4F, 0x0A, 0x55, 0x0A, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 11
-  0x00, 0x70, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x40, 0x70, 0x00, 
-  0x00, 0x7F, 0x01, 0x55, 0x29, 0x41, 0x2F, 0x49, 0x29, 0x4F, 0x21, 0x55, 0x29, 0x01, 0x7F, 0x00, 
-
-  //Frame 12
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 13
-  0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0xA8, 0x84, 0xEC, 0x84, 0xA8, 0x18, 0xE0, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x2A, 0x40, 0xAF, 0x40, 0x2A, 0x14, 0xFF, 0x00, 0x00, 0x00, 
-
-  //Frame 14
-  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xF8, 0xA8, 0x58, 0xAF, 0x58, 0xA8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Frame 15
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
-
-constexpr uint8_t spritesheet_Mask[] PROGMEM
-{
-  //Mask Frame 0
-  0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x00, 
-  0x00, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x00, 
-
-  //Mask Frame 1
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Mask Frame 2
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Mask Frame 3
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Mask Frame 4
-  0x00, 0x50, 0x30, 0xF0, 0xE4, 0xFA, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0xFA, 0xE4, 0xF0, 0x30, 0x50, 
-  0x00, 0x3D, 0x0F, 0xC7, 0x61, 0xFD, 0x7F, 0xDF, 0x1F, 0xDF, 0x7F, 0xFD, 0x61, 0xC7, 0x0F, 0x3D, 
-
-  //Mask Frame 5
-  0x00, 0x0C, 0x1E, 0x3E, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 
-
-  //Mask Frame 6
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0x3E, 0x1E, 0x0C, 0x00, 
-  0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 
-
-  //Mask Frame 7
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x78, 0x7C, 0x7C, 0x7C, 0x38, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x0C, 0x1E, 0x2F, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-
-  //Mask Frame 8
-  0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 
-  0x00, 0x00, 0x03, 0x07, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 
-
-  //Mask Frame 9
-  0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 
-
-  //Mask Frame 10
-  0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 
-  0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 
-
-  //Mask Frame 11
-  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-
-  //Mask Frame 12
-  0x00, 0x00, 0x60, 0x44, 0x88, 0x0E, 0x7C, 0xF2, 0xC0, 0xE3, 0x3C, 0x02, 0x00, 0x98, 0xE0, 0x10, 
-  0x04, 0x05, 0x02, 0x02, 0x01, 0x83, 0xC6, 0xFF, 0xFF, 0xFF, 0x82, 0x02, 0x05, 0x04, 0x02, 0x00, 
-
-  //Mask Frame 13
-  0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 
-  0x00, 0x40, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x20, 
-
-  //Mask Frame 14
-  0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0xFE, 0xFE, 0xFE, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 
-  0x40, 0x80, 0x00, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0x00, 0xC0, 0x20, 0x00, 
-
-  //Mask Frame 15
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
-};
+#pragma once
+
+#include <stdint.h>
+#include <avr/pgmspace.h>
+
+// You don't have to declare enums for your sprites but
+// it sure is nice sometimes. Also, we specifically mark it as
+// uint8_t because usually they're "int" and those are 2 bytes.
+enum MySprites : uint8_t {
+  Face = 0,
+  Unused1,
+  Unused2,
+  Unused3,
+  Monster,
+  LeverOff,
+  LeverOn,
+  Key,
+  Rock,
+  Crate,
+  Barrel,
+  Chest,
+  DeadTree,
+  Grave1,
+  Grave2
+};
+
+constexpr uint8_t spritesheetWidth = 16;
+constexpr uint8_t spritesheetHeight = 16;
+
+constexpr uint8_t spritesheet[] PROGMEM
+{
+  //Frame 0
+  0x00, 0xC0, 0x70, 0x18, 0x8C, 0x44, 0x86, 0x06, 0x06, 0x86, 0x44, 0x8C, 0x18, 0x70, 0xC0, 0x00, 
+  0x00, 0x03, 0x0E, 0x18, 0x30, 0x20, 0x62, 0x44, 0x44, 0x62, 0x20, 0x30, 0x18, 0x0E, 0x03, 0x00, 
+
+  //Frame 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 4
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x40, 0x00, 0x40, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 5
+  0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x1C, 0x00, 0x00, 0x00, 
+
+  //Frame 6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x1C, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x1C, 0x00, 0x00, 0x00, 
+
+  //Frame 7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 8
+  0x00, 0x00, 0x00, 0x00, 0xF0, 0xD8, 0xA8, 0x5C, 0xBC, 0x54, 0xA8, 0x50, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x01, 0x07, 0x03, 0x06, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 9
+  0x00, 0xE0, 0x28, 0x2C, 0xAE, 0xAA, 0x2A, 0xAA, 0xAA, 0x2A, 0xEA, 0x0E, 0x56, 0x0A, 0x54, 0x00, 
+  0x00, 0x7F, 0x40, 0x5B, 0x4D, 0x56, 0x5B, 0x4D, 0x56, 0x40, 0x7F, 0x00, 0x15, 0x08, 0x05, 0x00, 
+
+  //Frame 10
+  0x00, 0x00, 0x00, 0xD0, 0xB4, 0xB4, 0x6E, 0x2E, 0x4E, 0x2E, 0x54, 0x84, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x07, 0x37, 0x2F, 0x4F, 0x0A, 0x55, 0x0A, 0x15, 0x02, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 11
+  0x00, 0x70, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x50, 0x40, 0x40, 0x70, 0x00, 
+  0x00, 0x7F, 0x01, 0x55, 0x29, 0x41, 0x2F, 0x49, 0x29, 0x4F, 0x21, 0x55, 0x29, 0x01, 0x7F, 0x00, 
+
+  //Frame 12
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 13
+  0x00, 0x00, 0x00, 0x00, 0xE0, 0x18, 0xA8, 0x84, 0xEC, 0x84, 0xA8, 0x18, 0xE0, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xFF, 0x54, 0x2A, 0x40, 0xAF, 0x40, 0x2A, 0x14, 0xFF, 0x00, 0x00, 0x00, 
+
+  //Frame 14
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x20, 0x20, 0xFC, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0xF8, 0xA8, 0x58, 0xAF, 0x58, 0xA8, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Frame 15
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+constexpr uint8_t spritesheet_Mask[] PROGMEM
+{
+  //Mask Frame 0
+  0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xF0, 0xC0, 0x00, 
+  0x00, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x0F, 0x03, 0x00, 
+
+  //Mask Frame 1
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Mask Frame 2
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Mask Frame 3
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Mask Frame 4
+  0x00, 0x50, 0x30, 0xF0, 0xE4, 0xFA, 0xF0, 0xF8, 0xF8, 0xF8, 0xF0, 0xFA, 0xE4, 0xF0, 0x30, 0x50, 
+  0x00, 0x3D, 0x0F, 0xC7, 0x61, 0xFD, 0x7F, 0xDF, 0x1F, 0xDF, 0x7F, 0xFD, 0x61, 0xC7, 0x0F, 0x3D, 
+
+  //Mask Frame 5
+  0x00, 0x0C, 0x1E, 0x3E, 0xFC, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 
+
+  //Mask Frame 6
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFC, 0x3E, 0x1E, 0x0C, 0x00, 
+  0x00, 0x00, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x3F, 0x3E, 0x3E, 0x3E, 0x00, 0x00, 
+
+  //Mask Frame 7
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x78, 0x7C, 0x7C, 0x7C, 0x38, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x0C, 0x1E, 0x2F, 0x05, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+
+  //Mask Frame 8
+  0x00, 0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 
+  0x00, 0x00, 0x03, 0x07, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x1F, 0x1F, 0x07, 0x00, 0x00, 
+
+  //Mask Frame 9
+  0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x1F, 0x0F, 
+
+  //Mask Frame 10
+  0x00, 0x00, 0xF0, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF0, 0x00, 0x00, 
+  0x00, 0x00, 0x0F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x0F, 0x00, 0x00, 
+
+  //Mask Frame 11
+  0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 0xF8, 
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+
+  //Mask Frame 12
+  0x00, 0x00, 0x60, 0x44, 0x88, 0x0E, 0x7C, 0xF2, 0xC0, 0xE3, 0x3C, 0x02, 0x00, 0x98, 0xE0, 0x10, 
+  0x04, 0x05, 0x02, 0x02, 0x01, 0x83, 0xC6, 0xFF, 0xFF, 0xFF, 0x82, 0x02, 0x05, 0x04, 0x02, 0x00, 
+
+  //Mask Frame 13
+  0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0xFC, 0xFE, 0xFE, 0xFE, 0xFC, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 
+  0x00, 0x40, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x20, 
+
+  //Mask Frame 14
+  0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0xFE, 0xFE, 0xFE, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 
+  0x40, 0x80, 0x00, 0xF8, 0xFC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFC, 0xFC, 0xF8, 0x00, 0xC0, 0x20, 0x00, 
+
+  //Mask Frame 15
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
@@ -1,32 +1,43 @@
--- Tiles (use automatic mipmapping) --
-tiles,frames,width,height = image({
-	filename = "tiles2.png",
-	width = 32,
-	height = 32,
-	rawtiles = true,
-})
-raycast_helper("tilesheet", false, {
-	["32"] = tiles,
-	["16"] = image_resize(tiles, width, height, 16, 16),
-	["8"] = image_resize(tiles, width, height, 8, 8),
-	["4"] = image_resize(tiles, width, height, 4, 4),
-})
-
--- Sprites (use manual mipmapping) --
-function loadss(swidth)
-	sprites = image({
-		filename = "spritesheet" .. swidth .. ".png",
-		width = swidth,
-		height = swidth,
-		usemask = true,
-		rawtiles = true,
-	})
-	return sprites
-end
-
-raycast_helper("spritesheet", true, {
-	["32"] = loadss(32),
-	["16"] = loadss(16),
-	["8"] = loadss(8),
-	["4"] = loadss(4),
+-- The levels given to raycast_helper must match the layout the sketch uses (the
+-- last template parameter of RcContainer, RcFxLayout32 by default):
+-- RcFxLayout32    : 32, 16, 8, 4
+-- RcFxLayout32No4 : 32, 16, 8
+-- RcFxLayout16    : 16, 8, 4 (load 16x16 images and leave out the "32" entries)
+
+-- Tiles (use automatic mipmapping) --
+tiles,frames,width,height = image({
+	filename = "tiles2.png",
+	width = 32,
+	height = 32,
+	rawtiles = true,
+})
+raycast_helper("tilesheet", false, {
+	["32"] = tiles,
+	["16"] = image_resize(tiles, width, height, 16, 16),
+	["8"] = image_resize(tiles, width, height, 8, 8),
+	["4"] = image_resize(tiles, width, height, 4, 4),
+})
+
+-- Sprites (use manual mipmapping) --
+-- This writes spritesheet and spritesheet_Mask as separate sheets. If the sketch
+-- defines RCFXINTERLEAVEDSPRITES, the sheet must instead have each stripe's mask
+-- bytes directly after its data bytes (see "Interleaved sprites" in the readme).
+-- extras/fxinterleave does that to the generated bin, in place, for example:
+--   fxinterleave fxdata/fxdata_dev.bin 0x0002B0 0x000560 4 32
+function loadss(swidth)
+	sprites = image({
+		filename = "spritesheet" .. swidth .. ".png",
+		width = swidth,
+		height = swidth,
+		usemask = true,
+		rawtiles = true,
+	})
+	return sprites
+end
+
+raycast_helper("spritesheet", true, {
+	["32"] = loadss(32),
+	["16"] = loadss(16),
+	["8"] = loadss(8),
+	["4"] = loadss(4),
 })
\ No newline at end of file
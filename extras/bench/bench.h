@@ -0,0 +1,120 @@
+#pragma once
+
+// Shared setup for the benchmark programs. Each program is a single translation unit that 
+// includes this once, defines benchRun(), and prints through Serial.
+// - On the host, main() runs benchRun and returns its result (nonzero = failed)
+// - On AVR (simavr), Timer1 counts cycles, output goes to the simavr console, and the CPU stops
+//   (cli + sleep, which ends the simulation) when benchRun returns
+
+#include <Arduino.h>
+#include <Arduboy2.h>
+
+#ifdef __AVR__
+#include <avr/sleep.h>
+#include <simavr/avr/avr_mcu_section.h>
+AVR_MCU(F_CPU, "atmega32u4");
+AVR_MCU_SIMAVR_CONSOLE(&GPIOR0);
+#else
+#include <stdio.h>
+#endif
+
+uint8_t Arduboy2Base::sBuffer[(HEIGHT * WIDTH) / 8];
+HardwareSerial Serial;
+
+// Host times are noisy (page faults, the scheduler, frequency scaling), so the benchmarks which time
+// whole frames draw each one BENCHREPEAT times and count the fastest. Under simavr every run takes
+// the same cycles, so once is enough
+#ifndef BENCHREPEAT
+#ifdef __AVR__
+#define BENCHREPEAT 1
+#else
+#define BENCHREPEAT 9
+#endif
+#endif
+
+#ifdef __AVR__
+volatile uint16_t benchOverflows = 0;
+
+ISR(TIMER1_OVF_vect)
+{
+    benchOverflows++;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    GPIOR0 = c;
+    return 1;
+}
+
+// Elapsed time for the benchmarks; cycles on AVR, microseconds on the host
+inline uint32_t benchTime() { return benchCycles(); }
+#define BENCHTIMEUNIT "cycles"
+#else
+size_t HardwareSerial::write(uint8_t c)
+{
+    return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+inline uint32_t benchTime() { return micros(); }
+#define BENCHTIMEUNIT "us"
+#endif
+
+// Out of class definitions for the renderer's (and ray cache's) constants, for when the compiler 
+// decides to take their address (host builds without optimization)
+#define RCBENCHRENDERCONSTANTS(Render) \
+    template<uint8_t W, uint8_t H, uint8_t T> constexpr uflot Render<W, H, T>::INVWIDTH; \
+    template<uint8_t W, uint8_t H, uint8_t T> constexpr flot Render<W, H, T>::INVWIDTH2; \
+    template<uint8_t W, uint8_t H, uint8_t T> constexpr uflot Render<W, H, T>::SPRITEVIEWEXENTSION; \
+    template<uint8_t W> constexpr flot RcRayCache<W>::INVWIDTH2;
+
+// Same for the FX renderer (ArduboyRaycast_RenderFX.h), which takes a layout instead of a tile size
+#define RCBENCHFXRENDERCONSTANTS(Render) \
+    template<uint8_t W, uint8_t H, typename L> constexpr uflot Render<W, H, L>::INVWIDTH; \
+    template<uint8_t W, uint8_t H, typename L> constexpr flot Render<W, H, L>::INVWIDTH2; \
+    template<uint8_t W, uint8_t H, typename L> constexpr uflot Render<W, H, L>::SPRITEVIEWEXENTSION; \
+    template<uint8_t W> constexpr flot RcRayCache<W>::INVWIDTH2;
+
+// Print a "name value" line
+template<typename T>
+void benchReport(const __FlashStringHelper * name, T value)
+{
+    Serial.print(name);
+    Serial.print(' ');
+    Serial.println(value);
+}
+
+// Print a "name value" line for an average over count
+inline void benchReportAverage(const __FlashStringHelper * name, uint32_t total, uint16_t count)
+{
+    benchReport(name, count ? (double)total / count : 0.0);
+}
+
+int benchRun();
+
+#ifdef __AVR__
+int main()
+{
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);     // Full clock, no prescaler
+    TIMSK1 = _BV(TOIE1);
+    sei();
+
+    int result = benchRun();
+    Serial.print(F("result "));
+    Serial.println(result);
+
+    // simavr stops when the CPU sleeps with interrupts off
+    cli();
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sleep_cpu();
+    return result;
+}
+#else
+int main()
+{
+    int result = benchRun();
+    fflush(stdout);
+    return result;
+}
+#endif
@@ -0,0 +1,159 @@
+// Floor + ceiling casting (RCFLOORCASTING) over the usual camera path, in an open room with a few
+// pillars so plenty of floor shows. The path is run with no budget and then smaller floorBudgets,
+// reporting the floor pixels cast and the time per frame for each.
+// Fails if a frame casts more pixels than its budget, or if the pixels the renderer says it cast 
+// (stats.floorPixels) aren't the pixels it really wrote. To find those, each frame's floor is cast
+// again over an all black and then an all white screen: every pixel written ends up the same either
+// way, so the set pixels of the first plus the clear pixels of the second are the pixels written.
+
+#ifndef RCFLOORCASTING
+#define RCFLOORCASTING
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t ROOMSIZE = 16;
+constexpr uint8_t TURNFRAMES = 32;      // A full turn on the spot
+constexpr uint8_t WALKFRAMES = 96;      // Then walk forward, turning whenever blocked
+constexpr float MOVESPEED = 2.25f / 30;
+constexpr float ROTSPEED = 3.0f / 30;
+
+const uint16_t budgets[] = { 0xFFFF, 2000, 800 };
+
+RcRender<WIDTH, HEIGHT, RCTILESIZE> render;
+RcPlayer player;
+Arduboy2Base arduboy;
+
+uint8_t mapBuffer[ROOMSIZE * ROOMSIZE];
+RcMap worldMap(mapBuffer, ROOMSIZE, ROOMSIZE);
+
+bool isSolid(uflot x, uflot y)
+{
+    return worldMap.getCell(x.getInteger(), y.getInteger()) != 0;
+}
+
+// Walls around the edge, and a pillar every 4 tiles
+void loadRoom()
+{
+    worldMap.fillMap(RCEMPTY);
+    for(uint8_t i = 0; i < ROOMSIZE; i++)
+    {
+        worldMap.setCell(i, 0, 4);
+        worldMap.setCell(i, ROOMSIZE - 1, 4);
+        worldMap.setCell(0, i, 4);
+        worldMap.setCell(ROOMSIZE - 1, i, 4);
+    }
+    for(uint8_t y = 4; y < ROOMSIZE - 1; y += 4)
+        for(uint8_t x = 4; x < ROOMSIZE - 1; x += 4)
+            worldMap.setCell(x, y, 2);
+}
+
+// Advance the camera path one frame; same path as bench_render
+void moveCamera(uint8_t frame)
+{
+    if(frame < TURNFRAMES)
+    {
+        player.tryMovement(0, 6.2832f / TURNFRAMES, &isSolid);
+        return;
+    }
+
+    uflot x = player.posX;
+    uflot y = player.posY;
+    player.tryMovement(MOVESPEED, 0, &isSolid);
+    if(x == player.posX && y == player.posY)
+        player.tryMovement(0, ROTSPEED * 4, &isSolid);
+}
+
+// Count the pixels which are set (or clear) on screen
+uint16_t countPixels(bool set)
+{
+    uint16_t count = 0;
+    for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+        for(uint8_t b = set ? arduboy.sBuffer[i] : ~arduboy.sBuffer[i]; b; b &= b - 1)
+            count++;
+    return count;
+}
+
+// The pixels drawFloorCeiling really writes, using the walls from the last raycastWalls
+uint16_t countWritten()
+{
+    memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+    render.drawFloorCeiling(&player, &arduboy);
+    uint16_t written = countPixels(true);
+    memset(arduboy.sBuffer, 0xFF, sizeof(arduboy.sBuffer));
+    render.drawFloorCeiling(&player, &arduboy);
+    return written + countPixels(false);
+}
+
+bool runBudget(uint16_t budget)
+{
+    uint32_t pixels = 0;
+    uint32_t time = 0;
+    uint16_t maxPixels = 0;
+    uint16_t frames = 0;
+    uint32_t hash = 2166136261UL;
+    bool withinBudget = true;
+    bool counted = true;
+
+    player.posX = 2.5;
+    player.posY = 2.5;
+    player.initPlayerDirection(0, 1.0f);
+    render.floorBudget = budget;
+
+    for(uint8_t frame = 0; frame < TURNFRAMES + WALKFRAMES; frame++)
+    {
+        moveCamera(frame);
+
+        memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+        render.raycastWalls(&player, &worldMap, &arduboy);
+        uint32_t start = benchTime();
+        render.drawFloorCeiling(&player, &arduboy);
+        time += benchTime() - start;
+
+        uint16_t cast = render.stats.floorPixels;
+        pixels += cast;
+        maxPixels = max(maxPixels, cast);
+        withinBudget &= cast <= budget;
+        frames++;
+
+        for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+            hash = (hash ^ arduboy.sBuffer[i]) * 16777619UL;
+
+        counted &= countWritten() == cast;
+    }
+
+    Serial.print(F("== budget "));
+    Serial.println(budget);
+    benchReportAverage(F("floor_pixels"), pixels, frames);
+    benchReport(F("max_floor_pixels"), maxPixels);
+    benchReportAverage(F("time_" BENCHTIMEUNIT), time, frames);
+    Serial.print(F("hash "));
+    Serial.println(hash, 16);
+    benchReport(F("within_budget"), withinBudget ? F("ok") : F("FAILED"));
+    benchReport(F("count_matches"), counted ? F("ok") : F("FAILED"));
+    return withinBudget && counted;
+}
+
+int benchRun()
+{
+    #ifdef RCINTERLEAVEDSHEETS
+    render.tilesheet = RcInterleavedSheet<tilesheet, sizeof(tilesheet)>::data;
+    #else
+    render.tilesheet = tilesheet;
+    #endif
+    render.floorTile = 6;
+    render.ceilingTile = 4;
+    render.shading = RcShadingType::Black;
+    render.setLightIntensity(1.5);
+    loadRoom();
+
+    bool pass = true;
+    for(uint8_t i = 0; i < sizeof(budgets) / sizeof(budgets[0]); i++)
+        pass &= runBudget(budgets[i]);
+    return pass ? 0 : 1;
+}
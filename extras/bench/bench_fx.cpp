@@ -0,0 +1,273 @@
+// The FX renderer (ArduboyRaycastFX.h) over the usual camera path, reading from the made up flash
+// chip in stubs/ArduboyFX.h. Reports the work done per frame (RCRENDERSTATS), the FX seeks and
+// bytes read (plus the strip cache's hits with RCFXCACHE), and the time taken, which leaves out
+// the real transfer. The frame hash changes whenever the output does, so build with and without
+// the RCFX* flags to check they only change the reads. Fails if the renderer ever uses the chip
+// out of order (a read without a seek, or a seek during a read)
+// With RCFXINTERLEAVEDSPRITES, the two sprite sheets are interleaved by extras/fxinterleave into one
+// at the spritesheet address, so the frames must hash the same as without it
+// Scenes:
+// - room: 7_fx's room of pillars, with 16 sprites of mixed sizes
+// - halls: long corridors of mixed tiles with side rooms, seen down their length
+// Set BENCHFXLAYOUT to bench another layout, eg: make run FLAGS="-DBENCHFXLAYOUT=RcFxLayout16"
+
+#include "bench.h"
+
+#include <ArduboyRaycastFX.h>
+
+#ifdef RCFXINTERLEAVEDSPRITES
+#include "../fxinterleave/fxinterleave.h"
+#endif
+
+#ifndef BENCHFXLAYOUT
+#define BENCHFXLAYOUT RcFxLayout32
+#endif
+
+RCBENCHFXRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t NUMSPRITES = 16;
+constexpr uint8_t TURNFRAMES = 32;      // A full turn on the spot
+constexpr uint8_t WALKFRAMES = 96;      // Then walk forward, turning whenever blocked
+constexpr float MOVESPEED = 2.25f / 30;
+constexpr float ROTSPEED = 3.0f / 30;
+
+// Where 7_fx's fxdata puts its sheets. The made up flash has something everywhere, so these only
+// matter for how the reads line up
+constexpr uint24_t TILESHEET = 0x000000;
+constexpr uint24_t SPRITESHEET = 0x0002B0;
+constexpr uint24_t SPRITESHEETMASK = 0x000560;
+constexpr uint8_t SPRITEFRAMES = 4;
+
+// Hallways for the second scene: 0 is empty, everything else a tile
+const uint8_t halls[RCMAXMAPDIMENSION * RCMAXMAPDIMENSION] PROGMEM = {
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    1,0,2,2,3,3,2,2,3,3,2,2,3,3,0,1,
+    1,0,2,0,0,0,0,0,0,0,0,0,0,4,0,1,
+    1,0,3,0,4,4,4,0,4,4,4,4,0,4,0,1,
+    1,0,3,0,4,0,0,0,0,0,0,4,0,3,0,1,
+    1,0,2,0,4,0,1,1,1,1,0,4,0,3,0,1,
+    1,0,2,0,0,0,1,0,0,1,0,0,0,2,0,1,
+    1,0,3,0,4,0,1,0,0,1,0,4,0,2,0,1,
+    1,0,3,0,4,0,1,1,0,1,0,4,0,3,0,1,
+    1,0,2,0,4,0,0,0,0,0,0,4,0,3,0,1,
+    1,0,2,0,4,4,4,4,0,4,4,4,0,4,0,1,
+    1,0,3,0,0,0,0,0,0,0,0,0,0,4,0,1,
+    1,0,3,3,2,2,3,3,2,2,3,3,2,2,0,1,
+    1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,
+    1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+};
+
+#ifdef RCFXINTERLEAVEDSPRITES
+constexpr uint16_t SHEETBYTES = SPRITEFRAMES * BENCHFXLAYOUT::FRAMEBYTES;
+uint8_t interleavedSprites[2 * SHEETBYTES];
+
+// Interleave the made up sheets the way fxinterleave does, and put the result over them
+void interleaveSprites()
+{
+    uint8_t sheet[SHEETBYTES];
+    uint8_t mask[SHEETBYTES];
+    for(uint16_t i = 0; i < SHEETBYTES; i++)
+    {
+        sheet[i] = FX::benchFlashByte(SPRITESHEET + i);
+        mask[i] = FX::benchFlashByte(SPRITESHEETMASK + i);
+    }
+
+    // The layout's levels are the distinct widths in its mipmap table
+    uint8_t levels[BENCHFXLAYOUT::MIPSTEPS + 1] = { 0 };
+    uint8_t count = 0;
+    for(uint8_t i = 0; i < BENCHFXLAYOUT::MIPSTEPS; i++)
+    {
+        MipMapInfo info;
+        memcpy_P(&info, BENCHFXLAYOUT::mipmaps() + i, sizeof(MipMapInfo));
+        if(!count || levels[count - 1] != info.width)
+            levels[count++] = info.width;
+    }
+
+    fxInterleaveSprites(sheet, mask, SPRITEFRAMES, levels, interleavedSprites);
+    FX::benchOverlay(SPRITESHEET, interleavedSprites, sizeof(interleavedSprites));
+}
+#endif
+
+RcContainer<NUMSPRITES, 1, WIDTH, HEIGHT, BENCHFXLAYOUT> raycast(TILESHEET, SPRITESHEET, SPRITESHEETMASK);
+Arduboy2Base arduboy;
+
+bool isSolid(uflot x, uflot y)
+{
+    return raycast.worldMap.getCell(x.getInteger(), y.getInteger()) != 0 ||
+        raycast.sprites.firstColliding(x, y, RBSTATESOLID) != NULL;
+}
+
+// Same room as 7_fx's setup
+void loadRoom()
+{
+    randomSeed(1);
+    raycast.sprites.resetAll();
+    raycast.render.setLightIntensity(2.0);
+    raycast.render.spritescaling[2] = 0.75;
+    raycast.render.spriteShading = RcShadingType::Black;
+
+    raycast.worldMap.fillMap(RCEMPTY);
+    for(uint8_t i = 0; i < RCMAXMAPDIMENSION; i++)
+    {
+        raycast.worldMap.setCell(i, 0, 2);
+        raycast.worldMap.setCell(i, RCMAXMAPDIMENSION - 1, 2);
+        raycast.worldMap.setCell(0, i, 2);
+        raycast.worldMap.setCell(RCMAXMAPDIMENSION - 1, i, 2);
+    }
+    for(uint8_t i = 2; i < RCMAXMAPDIMENSION - 2; i += 2)
+        for(uint8_t j = 2; j < RCMAXMAPDIMENSION - 2; j += 3)
+            raycast.worldMap.setCell(i, j, 1);
+
+    for(uint8_t i = 0; i < NUMSPRITES; i++)
+    {
+        uint8_t tile = random(2);
+        RcSprite<1> * sprite = raycast.sprites.addSprite(1.5f + random(9), 2.5f + random(9), 1 + tile, 2 - tile, 9 - 2 * tile, NULL);
+        raycast.sprites.addSpriteBounds(sprite, 0.5f + 0.25f * tile, true);
+    }
+
+    // The middle of the room, where the sprites are
+    raycast.player.posX = 5.5;
+    raycast.player.posY = 6.5;
+    raycast.player.initPlayerDirection(0, 1.0f);
+}
+
+void loadHalls()
+{
+    randomSeed(2);
+    raycast.sprites.resetAll();
+    raycast.render.setLightIntensity(3.0);
+    raycast.render.spriteShading = RcShadingType::Black;
+
+    for(uint8_t y = 0; y < RCMAXMAPDIMENSION; y++)
+        for(uint8_t x = 0; x < RCMAXMAPDIMENSION; x++)
+            raycast.worldMap.setCell(x, y, pgm_read_byte(halls + y * RCMAXMAPDIMENSION + x));
+
+    for(uint8_t placed = 0; placed < NUMSPRITES / 2; )
+    {
+        uint8_t x = 1 + random(14);
+        uint8_t y = 1 + random(14);
+        if(raycast.worldMap.getCell(x, y))
+            continue;
+        raycast.sprites.addSprite(x + 0.5f, y + 0.5f, random(SPRITEFRAMES), 1 + random(2), 0, NULL);
+        placed++;
+    }
+
+    raycast.player.posX = 1.5;
+    raycast.player.posY = 14.5;
+    raycast.player.initPlayerDirection(0, 1.0f);
+}
+
+// Advance the camera path one frame
+void moveCamera(uint8_t frame)
+{
+    if(frame < TURNFRAMES)
+    {
+        raycast.player.tryMovement(0, 6.2832f / TURNFRAMES, &isSolid);
+        return;
+    }
+
+    uflot x = raycast.player.posX;
+    uflot y = raycast.player.posY;
+    raycast.player.tryMovement(MOVESPEED, 0, &isSolid);
+    if(x == raycast.player.posX && y == raycast.player.posY)
+        raycast.player.tryMovement(0, ROTSPEED * 4, &isSolid);
+}
+
+struct SceneTotals
+{
+    uint32_t ddaSteps = 0;
+    uint32_t wallPixels = 0;
+    uint32_t spriteStripes = 0;
+    uint32_t seeks = 0;
+    uint32_t bytes = 0;
+    uint32_t time = 0;
+    uint16_t frames = 0;
+    uint32_t hash = 2166136261UL;
+};
+
+bool runScene(const __FlashStringHelper * name)
+{
+    SceneTotals totals;
+    FX::BenchState & fx = FX::benchState();
+    #ifdef RCFXCACHE
+    raycast.render.stripCache.hits = 0;
+    raycast.render.stripCache.misses = 0;
+    #endif
+
+    for(uint8_t frame = 0; frame < TURNFRAMES + WALKFRAMES; frame++)
+    {
+        moveCamera(frame);
+
+        // Every repeat draws the same frame from the same cache state, so reads are only counted
+        // once. See BENCHREPEAT
+        #ifdef RCFXCACHE
+        RcFxStripCache cache = raycast.render.stripCache;
+        #endif
+        uint32_t time = 0xFFFFFFFF;
+        for(uint8_t repeat = 0; repeat < BENCHREPEAT; repeat++)
+        {
+            #ifdef RCFXCACHE
+            if(repeat)
+                raycast.render.stripCache = cache;
+            #endif
+            memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+            uint32_t seeks = fx.seeks;
+            uint32_t bytes = fx.bytes;
+            uint32_t start = benchTime();
+            raycast.runIteration(&arduboy);
+            time = min(time, benchTime() - start);
+            if(!repeat)
+            {
+                totals.seeks += fx.seeks - seeks;
+                totals.bytes += fx.bytes - bytes;
+            }
+        }
+        totals.time += time;
+
+        auto & stats = raycast.render.stats;
+        totals.ddaSteps += stats.ddaSteps;
+        totals.wallPixels += stats.wallPixels;
+        totals.spriteStripes += stats.spriteStripes;
+        totals.frames++;
+
+        for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+            totals.hash = (totals.hash ^ arduboy.sBuffer[i]) * 16777619UL;
+    }
+
+    bool ok = !fx.misuse && !fx.reading;
+
+    Serial.print(F("== "));
+    Serial.println(name);
+    benchReport(F("frames"), totals.frames);
+    benchReportAverage(F("dda_steps"), totals.ddaSteps, totals.frames);
+    benchReportAverage(F("wall_pixels"), totals.wallPixels, totals.frames);
+    benchReportAverage(F("sprite_stripes"), totals.spriteStripes, totals.frames);
+    benchReportAverage(F("fx_seeks"), totals.seeks, totals.frames);
+    benchReportAverage(F("fx_bytes"), totals.bytes, totals.frames);
+    #ifdef RCFXCACHE
+    benchReportAverage(F("cache_hits"), raycast.render.stripCache.hits, totals.frames);
+    benchReportAverage(F("cache_misses"), raycast.render.stripCache.misses, totals.frames);
+    #endif
+    benchReportAverage(F("time_" BENCHTIMEUNIT), totals.time, totals.frames);
+    Serial.print(F("hash "));
+    Serial.println(totals.hash, 16);
+    benchReport(F("fx_reads"), ok ? F("ok") : F("FAILED"));
+
+    #ifdef RCPROFILE
+    raycast.render.profiler.print(&Serial);
+    #endif
+    return ok;
+}
+
+int benchRun()
+{
+    #ifdef RCFXINTERLEAVEDSPRITES
+    interleaveSprites();
+    #endif
+    loadRoom();
+    bool pass = runScene(F("room"));
+    loadHalls();
+    pass &= runScene(F("halls"));
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,280 @@
+// Compares the map types by running only the wall raycaster over the same 16x16 maze, stored as
+// RcMap, RcPackedMap<4>, RcPackedMap<2> and RcProgmemMap, plus RcProgmemMap with a full overlay
+// of 4 and 8 cells (which every tile read scans). The DDA reads a cell every step, so time per
+// step shows the cost of each type's getTile. Every type must draw the exact same
+// frames; a mismatch (or a failed map check below) fails the run.
+// Before that, checks the map edge cases: RLE round trips into each map type, bad RLE data
+// (zero length run, tile not in the palette) being rejected, and fillMap on a packed map whose
+// size isn't a whole number of bytes.
+
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t MAZESIZE = 16;
+constexpr uint8_t TURNFRAMES = 32;      // A full turn on the spot
+constexpr uint8_t WALKFRAMES = 96;      // Then walk forward, turning whenever blocked
+constexpr float MOVESPEED = 2.25f / 30;
+constexpr float ROTSPEED = 3.0f / 30;
+
+// An Eller maze from 4_demo_collectcoins (randomSeed(1)), with a few walls swapped out so there's
+// 4 tiles (including empty), the most RcPackedMap<2> can hold
+constexpr uint8_t MazeMap[MAZESIZE * MAZESIZE] PROGMEM = {
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 0, 0, 0, 2, 2,
+    2, 0, 3, 0, 2, 0, 2, 2, 1, 0, 2, 0, 3, 0, 2, 2,
+    2, 0, 3, 0, 2, 0, 0, 0, 0, 0, 2, 0, 3, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 0, 3, 0, 2, 2,
+    2, 0, 2, 0, 2, 0, 2, 0, 0, 0, 0, 0, 3, 0, 2, 2,
+    2, 0, 2, 0, 2, 0, 1, 1, 1, 0, 2, 0, 3, 0, 2, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 0, 2, 2,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 0, 2, 0, 2, 0, 2, 0, 0, 0, 2, 0, 1, 0, 2, 2,
+    2, 0, 2, 2, 2, 0, 2, 0, 3, 3, 2, 0, 1, 0, 2, 2,
+    2, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 1, 0, 2, 2,
+    2, 0, 2, 0, 1, 0, 2, 0, 3, 0, 2, 0, 1, 0, 2, 2,
+    2, 0, 0, 0, 1, 0, 2, 0, 3, 0, 2, 0, 0, 0, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+
+RcRender<WIDTH, HEIGHT, RCTILESIZE> render;
+RcPlayer player;
+Arduboy2Base arduboy;
+
+uint8_t mapBuffer[MAZESIZE * MAZESIZE];
+uint8_t packed4Buffer[MAZESIZE * MAZESIZE / 2];
+uint8_t packed2Buffer[MAZESIZE * MAZESIZE / 4];
+
+RcMap byteMap(mapBuffer, MAZESIZE, MAZESIZE);
+RcPackedMap<4> packed4Map;
+RcPackedMap<2> packed2Map;
+RcProgmemMap<> progmemMap;
+RcProgmemMap<4> overlay4Map;
+RcProgmemMap<8> overlay8Map;
+
+// Reads RLE data out of RAM, for decodeRleMap
+struct RamReader
+{
+    const uint8_t * data;
+
+    inline uint8_t next()
+    {
+        return *this->data++;
+    }
+};
+
+template<uint8_t Bits>
+void setupPacked(RcPackedMap<Bits> * map, uint8_t * buffer, uint8_t width, uint8_t height)
+{
+    map->map = buffer;
+    map->width = width;
+    map->height = height;
+    for(uint8_t i = 0; i < map->PALETTESIZE; i++)
+        map->palette[i] = i;
+}
+
+// Fill the whole overlay with cells from the bottom row. Rays never get past the row above it
+// (solid), so the frames don't change, but every tile read misses and scans the full list
+template<uint8_t OverlayCells>
+bool fillOverlay(RcProgmemMap<OverlayCells> * map)
+{
+    map->load(MazeMap, MAZESIZE, MAZESIZE);
+    for(uint8_t x = 0; x < OverlayCells; x++)
+        if(!map->setCell(x, MAZESIZE - 1, 1))
+            return false;
+    return map->overlayCount == OverlayCells && !map->setCell(OverlayCells, MAZESIZE - 1, 1);
+}
+
+// Copy the maze into the given (RAM) map with setCell
+template<typename MapType>
+bool loadMaze(MapType * map)
+{
+    for(uint8_t y = 0; y < MAZESIZE; y++)
+        for(uint8_t x = 0; x < MAZESIZE; x++)
+            if(!map->setCell(x, y, pgm_read_byte(MazeMap + y * MAZESIZE + x)))
+                return false;
+    return true;
+}
+
+template<typename MapType>
+bool matchesMaze(MapType * map)
+{
+    for(uint8_t y = 0; y < MAZESIZE; y++)
+        for(uint8_t x = 0; x < MAZESIZE; x++)
+            if(map->getCell(x, y) != pgm_read_byte(MazeMap + y * MAZESIZE + x))
+                return false;
+    return true;
+}
+
+// Run length encode the maze (run, tile pairs) into rle, returns the length
+uint16_t encodeMaze(uint8_t * rle)
+{
+    uint16_t length = 0;
+    uint16_t i = 0;
+    while(i < MAZESIZE * MAZESIZE)
+    {
+        uint8_t tile = pgm_read_byte(MazeMap + i);
+        uint8_t run = 0;
+        while(i < MAZESIZE * MAZESIZE && run < 255 && pgm_read_byte(MazeMap + i) == tile)
+        {
+            run++;
+            i++;
+        }
+        rle[length++] = run;
+        rle[length++] = tile;
+    }
+    return length;
+}
+
+template<typename MapType>
+bool checkRle(const __FlashStringHelper * name, MapType * map, const uint8_t * rle)
+{
+    RamReader reader { rle };
+    bool ok = decodeRleMap(map, &reader) && matchesMaze(map);
+    benchReport(name, ok ? F("ok") : F("FAILED"));
+    return ok;
+}
+
+bool checkMaps()
+{
+    bool ok = true;
+    uint8_t rle[MAZESIZE * MAZESIZE * 2];
+    encodeMaze(rle);
+
+    ok &= checkRle(F("rle_map"), &byteMap, rle);
+    ok &= checkRle(F("rle_packed4"), &packed4Map, rle);
+    ok &= checkRle(F("rle_packed2"), &packed2Map, rle);
+
+    // A zero length run is bad data, not 256 cells
+    const uint8_t zeroRun[] = { 16, 2, 0, 2, 240, 0 };
+    RamReader zeroReader { zeroRun };
+    bool rejected = !decodeRleMap(&byteMap, &zeroReader);
+    benchReport(F("rle_zero_run_rejected"), rejected ? F("ok") : F("FAILED"));
+    ok &= rejected;
+
+    // 5 isn't in the 2 bit palette (0-3)
+    const uint8_t badTile[] = { 16, 2, 1, 5, 239, 0 };
+    RamReader badReader { badTile };
+    rejected = !decodeRleMap(&packed2Map, &badReader) && !packed2Map.fillMap(5);
+    benchReport(F("rle_bad_tile_rejected"), rejected ? F("ok") : F("FAILED"));
+    ok &= rejected;
+
+    // 5x3 at 2 bits = 15 cells: 3 whole bytes, then 3 cells of the 4th. The 4th cell of that byte
+    // and the byte after it aren't part of the map and must be left alone
+    uint8_t oddBuffer[5] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xA5 };
+    RcPackedMap<2> oddMap;
+    setupPacked(&oddMap, oddBuffer, 5, 3);
+    bool filled = oddMap.fillMap(1);
+    for(uint8_t y = 0; y < 3; y++)
+        for(uint8_t x = 0; x < 5; x++)
+            filled &= oddMap.getCell(x, y) == 1;
+    filled &= oddBuffer[3] == 0xD5 && oddBuffer[4] == 0xA5;
+    benchReport(F("fill_remainder"), filled ? F("ok") : F("FAILED"));
+    ok &= filled;
+
+    // Leave every map holding the maze for the benchmark
+    ok &= loadMaze(&byteMap) && loadMaze(&packed4Map) && loadMaze(&packed2Map);
+    progmemMap.load(MazeMap, MAZESIZE, MAZESIZE);
+    bool full = fillOverlay(&overlay4Map) && fillOverlay(&overlay8Map);
+    benchReport(F("overlay_full"), full ? F("ok") : F("FAILED"));
+    ok &= full;
+    return ok;
+}
+
+bool isSolid(uflot x, uflot y)
+{
+    return byteMap.getCell(x.getInteger(), y.getInteger()) != 0;
+}
+
+// Advance the camera path one frame; same path as bench_render
+void moveCamera(uint8_t frame)
+{
+    if(frame < TURNFRAMES)
+    {
+        player.tryMovement(0, 6.2832f / TURNFRAMES, &isSolid);
+        return;
+    }
+
+    uflot x = player.posX;
+    uflot y = player.posY;
+    player.tryMovement(MOVESPEED, 0, &isSolid);
+    if(x == player.posX && y == player.posY)
+        player.tryMovement(0, ROTSPEED * 4, &isSolid);
+}
+
+// Returns the frame hash
+template<typename MapType>
+uint32_t runScene(const __FlashStringHelper * name, MapType * map)
+{
+    uint32_t ddaSteps = 0;
+    uint32_t time = 0;
+    uint16_t frames = 0;
+    uint32_t hash = 2166136261UL;
+
+    player.posX = 1.5;
+    player.posY = 1.5;
+    player.initPlayerDirection(0, 1.0f);
+
+    for(uint8_t frame = 0; frame < TURNFRAMES + WALKFRAMES; frame++)
+    {
+        moveCamera(frame);
+
+        // The same frame every repeat, see BENCHREPEAT
+        uint32_t best = 0xFFFFFFFF;
+        for(uint8_t repeat = 0; repeat < BENCHREPEAT; repeat++)
+        {
+            memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+            uint32_t start = benchTime();
+            render.raycastWalls(&player, map, &arduboy);
+            best = min(best, benchTime() - start);
+        }
+        time += best;
+        ddaSteps += render.stats.ddaSteps;
+        frames++;
+
+        for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+            hash = (hash ^ arduboy.sBuffer[i]) * 16777619UL;
+    }
+
+    Serial.print(F("== "));
+    Serial.println(name);
+    benchReport(F("frames"), frames);
+    benchReportAverage(F("dda_steps"), ddaSteps, frames);
+    benchReportAverage(F("time_" BENCHTIMEUNIT), time, frames);
+    benchReport(F("time_per_1000_steps_" BENCHTIMEUNIT), ddaSteps ? 1000.0 * time / ddaSteps : 0.0);
+    Serial.print(F("hash "));
+    Serial.println(hash, 16);
+    return hash;
+}
+
+int benchRun()
+{
+    #ifdef RCINTERLEAVEDSHEETS
+    render.tilesheet = RcInterleavedSheet<tilesheet, sizeof(tilesheet)>::data;
+    #else
+    render.tilesheet = tilesheet;
+    #endif
+    render.shading = RcShadingType::Black;
+    render.altWallShading = RcShadingType::Black;
+    render.setLightIntensity(1.0);
+
+    setupPacked(&packed4Map, packed4Buffer, MAZESIZE, MAZESIZE);
+    setupPacked(&packed2Map, packed2Buffer, MAZESIZE, MAZESIZE);
+
+    if(!checkMaps())
+        return 1;
+
+    uint32_t hash = runScene(F("map"), &byteMap);
+    bool same = runScene(F("packed4"), &packed4Map) == hash;
+    same &= runScene(F("packed2"), &packed2Map) == hash;
+    same &= runScene(F("progmem"), &progmemMap) == hash;
+    same &= runScene(F("progmem_overlay4"), &overlay4Map) == hash;
+    same &= runScene(F("progmem_overlay8"), &overlay8Map) == hash;
+    benchReport(F("same_frames"), same ? F("ok") : F("FAILED"));
+    return same ? 0 : 1;
+}
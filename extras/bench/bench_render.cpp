@@ -0,0 +1,205 @@
+// Replays a scripted camera path over the example maps and reports the work done per frame
+// (RCRENDERSTATS) plus the time taken, and how many wall columns reused the last column's
+// projection and texture strip. Build with the same flags as your game (FLAGS=... in the
+// Makefile) to compare settings; the frame hash changes whenever the output does. With
+// RCINTERLEAVEDSHEETS, the sheets are converted by RcInterleavedSheet / RcInterleavedSprites, so
+// the frames must hash the same as without it.
+// Scenes:
+// - cave, overworld: the two areas of 4_demo_regions, with their sprites and shading
+// - maze: an Eller maze from 4_demo_collectcoins, with 16 coin sprites
+
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+#include "../../examples/4_demo_regions/maps.h"
+#include "../../examples/4_demo_collectcoins/mazegen.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t NUMSPRITES = 16;
+constexpr uint8_t TURNFRAMES = 32;      // A full turn on the spot
+constexpr uint8_t WALKFRAMES = 96;      // Then walk forward, turning whenever blocked
+constexpr float MOVESPEED = 2.25f / 30;
+constexpr float ROTSPEED = 3.0f / 30;
+
+#ifdef RCINTERLEAVEDSHEETS
+RcContainer<NUMSPRITES, 1, WIDTH, HEIGHT> raycast(RcInterleavedSheet<tilesheet, sizeof(tilesheet)>::data, 
+    RcInterleavedSprites<spritesheet, spritesheet_Mask, sizeof(spritesheet)>::data, NULL);
+#else
+RcContainer<NUMSPRITES, 1, WIDTH, HEIGHT> raycast(tilesheet, spritesheet, spritesheet_Mask);
+#endif
+Arduboy2Base arduboy;
+
+bool isSolid(uflot x, uflot y)
+{
+    return raycast.worldMap.getCell(x.getInteger(), y.getInteger()) != 0 ||
+        raycast.sprites.firstColliding(x, y, RBSTATESOLID) != NULL;
+}
+
+// Same as 4_demo_regions' loadArea, minus the loading zones
+void loadArea(uint8_t area)
+{
+    MapInfo map;
+    memcpy_P(&map, AllMaps + area, sizeof(MapInfo));
+
+    raycast.sprites.resetAll();
+    raycast.render.shading = map.ShadeType;
+    raycast.render.altWallShading = map.AltShading;
+    raycast.render.setLightIntensity((uflot)map.LightLevel);
+    raycast.player.posX = (uflot)map.SpawnX;
+    raycast.player.posY = (uflot)map.SpawnY;
+    raycast.player.initPlayerDirection(0, 1.0f);
+
+    raycast.worldMap.fillMap(RCEMPTY);
+    for(uint8_t y = 0; y < map.Height; y++)
+        memcpy_P(raycast.mapBuffer + (y * RCMAXMAPDIMENSION), map.MapData + (y * map.Width), map.Width);
+
+    for(uint8_t i = 0; i < NUMSPRITES; i++)
+    {
+        SpriteInfo spinfo;
+        memcpy_P(&spinfo, map.SpriteData + i, sizeof(SpriteInfo));
+        if(spinfo.X == 0 && spinfo.Y == 0) break;
+        RcSprite<1> * sprite = raycast.sprites.addSprite(spinfo.X, spinfo.Y, spinfo.Frame, spinfo.Size, spinfo.Height, NULL);
+        if(spinfo.Collision > 0)
+            raycast.sprites.addSpriteBounds(sprite, spinfo.Collision, true);
+    }
+}
+
+void loadMaze()
+{
+    randomSeed(1);
+    raycast.sprites.resetAll();
+    raycast.render.shading = RcShadingType::Black;
+    raycast.render.altWallShading = RcShadingType::Black;
+    raycast.render.setLightIntensity(1.0);
+    ellerMaze(&raycast.worldMap, RCMAXMAPDIMENSION, RCMAXMAPDIMENSION, &raycast.player);
+    raycast.player.initPlayerDirection(0, 1.0f);
+
+    // Coins (well, keys), like 4_demo_collectcoins
+    for(uint8_t placed = 0; placed < NUMSPRITES; )
+    {
+        uint8_t x = 1 + random(14);
+        uint8_t y = 1 + random(14);
+        if(raycast.worldMap.getCell(x, y) || raycast.sprites.firstColliding(x + 0.5f, y + 0.5f, 0xFF))
+            continue;
+        RcSprite<1> * sprite = raycast.sprites.addSprite(x + 0.5f, y + 0.5f, MySprites::Key, 1, 0, NULL);
+        raycast.sprites.addSpriteBounds(sprite, 0.5f, false);
+        placed++;
+    }
+}
+
+// Advance the camera path one frame
+void moveCamera(uint8_t frame)
+{
+    if(frame < TURNFRAMES)
+    {
+        raycast.player.tryMovement(0, 6.2832f / TURNFRAMES, &isSolid);
+        return;
+    }
+
+    uflot x = raycast.player.posX;
+    uflot y = raycast.player.posY;
+    raycast.player.tryMovement(MOVESPEED, 0, &isSolid);
+    if(x == raycast.player.posX && y == raycast.player.posY)
+        raycast.player.tryMovement(0, ROTSPEED * 4, &isSolid);
+}
+
+struct SceneTotals
+{
+    uint32_t ddaSteps = 0;
+    uint32_t wallPixels = 0;
+    uint32_t spriteStripes = 0;
+    uint32_t spritePixels = 0;
+    uint32_t wallColumns = 0;
+    uint32_t linesReused = 0;
+    uint32_t stripsReused = 0;
+    uint32_t time = 0;
+    uint32_t maxTime = 0;
+    uint8_t maxColumnSteps = 0;
+    uint16_t frames = 0;
+    uint32_t hash = 2166136261UL;
+};
+
+void runScene(const __FlashStringHelper * name)
+{
+    SceneTotals totals;
+
+    for(uint8_t frame = 0; frame < TURNFRAMES + WALKFRAMES; frame++)
+    {
+        moveCamera(frame);
+
+        // Every repeat draws the same frame (sprites have no behaviors here), see BENCHREPEAT
+        uint32_t time = 0xFFFFFFFF;
+        for(uint8_t repeat = 0; repeat < BENCHREPEAT; repeat++)
+        {
+            memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+            uint32_t start = benchTime();
+            raycast.runIteration(&arduboy);
+            time = min(time, benchTime() - start);
+        }
+
+        auto & stats = raycast.render.stats;
+        totals.ddaSteps += stats.ddaSteps;
+        totals.wallPixels += stats.wallPixels;
+        totals.spriteStripes += stats.spriteStripes;
+        totals.spritePixels += stats.spritePixels;
+        totals.wallColumns += stats.wallColumns;
+        totals.linesReused += stats.linesReused;
+        totals.stripsReused += stats.stripsReused;
+        totals.time += time;
+        totals.maxTime = max(totals.maxTime, time);
+        totals.maxColumnSteps = max(totals.maxColumnSteps, stats.maxColumnSteps);
+        totals.frames++;
+
+        for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+            totals.hash = (totals.hash ^ arduboy.sBuffer[i]) * 16777619UL;
+
+        #ifdef BENCHVERBOSE
+        // frame ddasteps wallpixels spritestripes spritepixels time, then the steps of every column
+        Serial.print(frame); Serial.print(' ');
+        Serial.print(stats.ddaSteps); Serial.print(' ');
+        Serial.print(stats.wallPixels); Serial.print(' ');
+        Serial.print(stats.spriteStripes); Serial.print(' ');
+        Serial.print(stats.spritePixels); Serial.print(' ');
+        Serial.println(time);
+        for(uint8_t x = 0; x < raycast.render.VIEWWIDTH; x++)
+        {
+            Serial.print(stats.columnSteps[x]);
+            Serial.print(x + 1 < raycast.render.VIEWWIDTH ? ' ' : '\n');
+        }
+        #endif
+    }
+
+    Serial.print(F("== "));
+    Serial.println(name);
+    benchReport(F("frames"), totals.frames);
+    benchReportAverage(F("dda_steps"), totals.ddaSteps, totals.frames);
+    benchReport(F("max_column_steps"), totals.maxColumnSteps);
+    benchReportAverage(F("wall_pixels"), totals.wallPixels, totals.frames);
+    benchReportAverage(F("wall_columns"), totals.wallColumns, totals.frames);
+    benchReportAverage(F("lines_reused"), totals.linesReused, totals.frames);
+    benchReportAverage(F("strips_reused"), totals.stripsReused, totals.frames);
+    benchReportAverage(F("sprite_stripes"), totals.spriteStripes, totals.frames);
+    benchReportAverage(F("sprite_pixels"), totals.spritePixels, totals.frames);
+    benchReportAverage(F("time_" BENCHTIMEUNIT), totals.time, totals.frames);
+    benchReport(F("max_time_" BENCHTIMEUNIT), totals.maxTime);
+    Serial.print(F("hash "));
+    Serial.println(totals.hash, 16);
+
+    #ifdef RCPROFILE
+    raycast.render.profiler.print(&Serial);
+    #endif
+}
+
+int benchRun()
+{
+    loadArea(0);
+    runScene(F("cave"));
+    loadArea(1);
+    runScene(F("overworld"));
+    loadMaze();
+    runScene(F("maze"));
+    return 0;
+}
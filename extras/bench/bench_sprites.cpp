@@ -0,0 +1,191 @@
+// Sprite culling with a crowd: 64 sprites scattered around an open room with a few pillars, and
+// the usual camera path. Every frame the sprites are drawn twice over the same walls, once with
+// drawSprites (which culls before sorting) and once the way it was before culling: sort every
+// active sprite, then project each one and skip what calcSpriteDraw rejects. Reports how many
+// sprites were sorted either way, how many were drawn, and the time of each.
+// Sprite shading is off, so the culler's far distance isn't used and both must draw the exact
+// same frames; the run fails if they don't.
+
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+#include "../../examples/4_demo_regions/spritesheet.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t NUMSPRITES = 64;
+constexpr uint8_t ROOMSIZE = 16;
+constexpr uint8_t TURNFRAMES = 32;      // A full turn on the spot
+constexpr uint8_t WALKFRAMES = 96;      // Then walk forward, turning whenever blocked
+constexpr float MOVESPEED = 2.25f / 30;
+constexpr float ROTSPEED = 3.0f / 30;
+
+const uint8_t spriteFrames[] = { MySprites::Barrel, MySprites::Crate, MySprites::Rock, MySprites::Key, MySprites::Chest };
+
+RcRender<WIDTH, HEIGHT, RCTILESIZE> render;
+RcPlayer player;
+Arduboy2Base arduboy;
+
+uint8_t mapBuffer[ROOMSIZE * ROOMSIZE];
+RcMap worldMap(mapBuffer, ROOMSIZE, ROOMSIZE);
+
+RcSprite<1> spritesBuffer[NUMSPRITES];
+SSprite<1> sortedBuffer[NUMSPRITES];
+RcSpriteGroup<1> sprites;
+
+bool isSolid(uflot x, uflot y)
+{
+    return worldMap.getCell(x.getInteger(), y.getInteger()) != 0;
+}
+
+// Walls around the edge, and a pillar every 4 tiles
+void loadRoom()
+{
+    worldMap.fillMap(RCEMPTY);
+    for(uint8_t i = 0; i < ROOMSIZE; i++)
+    {
+        worldMap.setCell(i, 0, 4);
+        worldMap.setCell(i, ROOMSIZE - 1, 4);
+        worldMap.setCell(0, i, 4);
+        worldMap.setCell(ROOMSIZE - 1, i, 4);
+    }
+    for(uint8_t y = 4; y < ROOMSIZE - 1; y += 4)
+        for(uint8_t x = 4; x < ROOMSIZE - 1; x += 4)
+            worldMap.setCell(x, y, 2);
+}
+
+void loadSprites()
+{
+    randomSeed(1);
+    sprites.sprites = spritesBuffer;
+    sprites.sortedSprites = sortedBuffer;
+    sprites.bounds = NULL;
+    sprites.numsprites = NUMSPRITES;
+    sprites.numbounds = 0;
+    sprites.resetSprites();
+
+    for(uint8_t placed = 0; placed < NUMSPRITES; )
+    {
+        muflot x = muflot::fromInternal(0x10 + random(0xE0));
+        muflot y = muflot::fromInternal(0x10 + random(0xE0));
+        if(worldMap.getCell(x.getInteger(), y.getInteger()))
+            continue;
+        sprites.addSprite(x, y, spriteFrames[random(sizeof(spriteFrames))], random(4), 0, NULL);
+        placed++;
+    }
+}
+
+// Advance the camera path one frame; same path as bench_render
+void moveCamera(uint8_t frame)
+{
+    if(frame < TURNFRAMES)
+    {
+        player.tryMovement(0, 6.2832f / TURNFRAMES, &isSolid);
+        return;
+    }
+
+    uflot x = player.posX;
+    uflot y = player.posY;
+    player.tryMovement(MOVESPEED, 0, &isSolid);
+    if(x == player.posX && y == player.posY)
+        player.tryMovement(0, ROTSPEED * 4, &isSolid);
+}
+
+// drawSprites without the culler. Returns how many sprites were sorted
+uint8_t drawUnculled()
+{
+    RcSpriteDrawPrecalc precalc = render.precalcSpriteDraw(&player);
+    uint8_t usedSprites = sprites.sortSprites(player.posX, player.posY);
+
+    for(uint8_t i = 0; i < usedSprites; i++)
+    {
+        RcSprite<1> * sprite = sprites.sortedSprites[i].sprite;
+        RcSpriteDrawData drawData = render.calcSpriteDraw(&precalc, &player, sprite);
+        if(drawData.stepX == 0 && drawData.stepY == 0) continue;
+        render.drawSpriteStripes(drawData, render.spritesheet, render.spritesheet_mask, sprite->frame, &arduboy);
+    }
+
+    return usedSprites;
+}
+
+// How many sprites drawSprites' culler lets through to the sort
+uint8_t countCulled()
+{
+    RcSpriteDrawPrecalc precalc = render.precalcSpriteDraw(&player);
+    RcSpriteCuller<WIDTH, HEIGHT> culler = render.precalcSpriteCull(&precalc, &player);
+    uint8_t count = 0;
+    for(uint8_t i = 0; i < NUMSPRITES; i++)
+        if(sprites.sprites[i].isActive() && culler.visible(sprites.sprites + i))
+            count++;
+    return count;
+}
+
+uint32_t hashScreen(uint32_t hash)
+{
+    for(uint16_t i = 0; i < sizeof(arduboy.sBuffer); i++)
+        hash = (hash ^ arduboy.sBuffer[i]) * 16777619UL;
+    return hash;
+}
+
+int benchRun()
+{
+    #ifdef RCINTERLEAVEDSHEETS
+    // Converted, so the frames hash the same as without the flag (see bench_render)
+    render.tilesheet = RcInterleavedSheet<tilesheet, sizeof(tilesheet)>::data;
+    render.spritesheet = RcInterleavedSprites<spritesheet, spritesheet_Mask, sizeof(spritesheet)>::data;
+    #else
+    render.tilesheet = tilesheet;
+    render.spritesheet = spritesheet;
+    render.spritesheet_mask = spritesheet_Mask;
+    #endif
+    render.spriteShading = RcShadingType::None;
+    render.setLightIntensity(2.0);
+
+    loadRoom();
+    loadSprites();
+    player.posX = 2.5;
+    player.posY = 2.5;
+    player.initPlayerDirection(0, 1.0f);
+
+    uint32_t culledTime = 0, unculledTime = 0;
+    uint32_t culledSorted = 0, unculledSorted = 0, drawn = 0;
+    uint32_t culledHash = 2166136261UL, unculledHash = 2166136261UL;
+    uint16_t frames = 0;
+
+    for(uint8_t frame = 0; frame < TURNFRAMES + WALKFRAMES; frame++)
+    {
+        moveCamera(frame);
+
+        memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+        render.raycastWalls(&player, &worldMap, &arduboy);
+        uint32_t start = benchTime();
+        render.drawSprites(&player, &sprites, &arduboy);
+        culledTime += benchTime() - start;
+        drawn += render.stats.spritesDrawn;
+        culledSorted += countCulled();
+        culledHash = hashScreen(culledHash);
+
+        memset(arduboy.sBuffer, 0, sizeof(arduboy.sBuffer));
+        render.raycastWalls(&player, &worldMap, &arduboy);
+        start = benchTime();
+        unculledSorted += drawUnculled();
+        unculledTime += benchTime() - start;
+        unculledHash = hashScreen(unculledHash);
+
+        frames++;
+    }
+
+    benchReport(F("frames"), frames);
+    benchReport(F("sprites"), NUMSPRITES);
+    benchReportAverage(F("sprites_drawn"), drawn, frames);
+    benchReportAverage(F("culled_sorted"), culledSorted, frames);
+    benchReportAverage(F("culled_time_" BENCHTIMEUNIT), culledTime, frames);
+    benchReportAverage(F("unculled_sorted"), unculledSorted, frames);
+    benchReportAverage(F("unculled_time_" BENCHTIMEUNIT), unculledTime, frames);
+    Serial.print(F("hash "));
+    Serial.println(culledHash, 16);
+    benchReport(F("same_frames"), culledHash == unculledHash ? F("ok") : F("FAILED"));
+    return culledHash == unculledHash ? 0 : 1;
+}
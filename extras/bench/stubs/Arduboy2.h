@@ -0,0 +1,23 @@
+#pragma once
+
+// The parts of Arduboy2 the raycaster uses. The screen buffer is real, drawing other than 
+// through sBuffer does nothing
+
+#include <Arduino.h>
+
+constexpr uint8_t WIDTH = 128;
+constexpr uint8_t HEIGHT = 64;
+
+#define BLACK 0
+#define WHITE 1
+
+class Arduboy2Base
+{
+public:
+    static uint8_t sBuffer[(HEIGHT * WIDTH) / 8];
+
+    void drawPixel(int16_t, int16_t, uint8_t = WHITE) { }
+    void fillRect(int16_t, int16_t, uint8_t, uint8_t, uint8_t = WHITE) { }
+};
+
+class Arduboy2 : public Arduboy2Base { };
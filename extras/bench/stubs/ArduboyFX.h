@@ -0,0 +1,117 @@
+#pragma once
+
+// The parts of ArduboyFX the FX renderer uses, over a made up flash chip. Every byte of flash is
+// a fixed function of its address (so textures are noise, but the same noise every run, and
+// nothing has to be stored), and every seek + byte read is counted in FX::benchState(). Reads
+// are checked the same way the real chip needs them: a seek, then pending reads, then the last
+// read or readEnd. Anything else sets misuse. Reads are free here, so times from an FX
+// bench leave out the real transfer; compare seeks + bytes instead. benchOverlay puts real data
+// over part of the made up flash
+
+#include <Arduino.h>
+
+#ifdef __AVR__
+using uint24_t = __uint24;
+#else
+using uint24_t = uint32_t;
+#endif
+
+namespace FX
+{
+    struct BenchState
+    {
+        uint32_t address;
+        uint32_t seeks;
+        uint32_t bytes;
+        bool reading;
+        bool misuse;
+        const uint8_t * overlay;    // Read instead of the made up bytes, from overlayAddress on
+        uint32_t overlayAddress;
+        uint32_t overlayBytes;
+    };
+
+    inline BenchState & benchState()
+    {
+        static BenchState state;
+        return state;
+    }
+
+    // The made up contents of flash
+    inline uint8_t benchFlashByte(uint32_t address)
+    {
+        address = (address ^ (address >> 7)) * 2654435761UL;
+        return (uint8_t)(address >> 24);
+    }
+
+    inline void benchOverlay(uint32_t address, const uint8_t * data, uint32_t bytes)
+    {
+        BenchState & state = benchState();
+        state.overlay = data;
+        state.overlayAddress = address;
+        state.overlayBytes = bytes;
+    }
+
+    inline void begin(uint16_t) { }
+    inline void display(bool) { }
+
+    inline void seekData(uint24_t address)
+    {
+        BenchState & state = benchState();
+        state.misuse |= state.reading;
+        state.reading = true;
+        state.address = address;
+        state.seeks++;
+    }
+
+    inline uint8_t readPendingUInt8()
+    {
+        BenchState & state = benchState();
+        state.misuse |= !state.reading;
+        state.bytes++;
+        uint32_t address = state.address++;
+        if(state.overlay && address - state.overlayAddress < state.overlayBytes)
+            return state.overlay[address - state.overlayAddress];
+        return benchFlashByte(address);
+    }
+
+    inline uint8_t readPendingLastUInt8()
+    {
+        uint8_t result = readPendingUInt8();
+        benchState().reading = false;
+        return result;
+    }
+
+    // Big endian, like the real library
+    inline uint16_t readPendingUInt16()
+    {
+        uint16_t result = (uint16_t)readPendingUInt8() << 8;
+        return result | readPendingUInt8();
+    }
+
+    inline uint32_t readPendingUInt32()
+    {
+        uint32_t result = (uint32_t)readPendingUInt16() << 16;
+        return result | readPendingUInt16();
+    }
+
+    inline void readEnd()
+    {
+        BenchState & state = benchState();
+        state.misuse |= !state.reading;
+        state.reading = false;
+    }
+
+    inline void readDataBytes(uint24_t address, uint8_t * buffer, size_t length)
+    {
+        seekData(address);
+        for(size_t i = 0; i < length; i++)
+            buffer[i] = readPendingUInt8();
+        readEnd();
+    }
+
+    template<typename T>
+    inline void readDataObject(uint24_t address, T & object)
+    {
+        readDataBytes(address, (uint8_t *)&object, sizeof(T));
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+// Just enough of the Arduino core to build the library for the benchmarks, on the host or on a
+// bare AVR (simavr). Not a real core: there's no setup()/loop(), no pins, no serial hardware
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <avr/pgmspace.h>
+
+#ifdef __AVR__
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#else
+#include <time.h>
+#endif
+
+#define abs(x) ((x)>0?(x):-(x))
+#define min(a,b) ((a)<(b)?(a):(b))
+#define max(a,b) ((a)>(b)?(a):(b))
+
+// Deterministic, so every run replays the same scene. Same interface as Arduino's random()
+inline uint32_t & benchRandomState()
+{
+    static uint32_t state = 1;
+    return state;
+}
+
+inline void randomSeed(unsigned long seed)
+{
+    benchRandomState() = seed ? seed : 1;
+}
+
+inline long random(long howbig)
+{
+    if(howbig <= 0)
+        return 0;
+    uint32_t & state = benchRandomState();
+    state = state * 1103515245UL + 12345UL;
+    return (long)((state >> 8) % (uint32_t)howbig);
+}
+
+inline long random(long howsmall, long howbig)
+{
+    return howsmall >= howbig ? howsmall : howsmall + random(howbig - howsmall);
+}
+
+#ifdef __AVR__
+// Timer1 runs at the full clock and the bench counts its overflows (see main in bench.h), so time 
+// is in real cycles. micros() is derived from that rather than Arduino's 4us timer0
+extern volatile uint16_t benchOverflows;
+
+inline uint32_t benchCycles()
+{
+    uint8_t sreg = SREG;
+    cli();
+    uint16_t count = TCNT1;
+    uint16_t overflows = benchOverflows;
+    if((TIFR1 & _BV(TOV1)) && count < 0x8000)
+        overflows++;
+    SREG = sreg;
+    return ((uint32_t)overflows << 16) | count;
+}
+
+inline unsigned long micros() { return benchCycles() / (F_CPU / 1000000UL); }
+#else
+inline unsigned long micros()
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long)now.tv_sec * 1000000UL + now.tv_nsec / 1000;
+}
+#endif
+
+inline unsigned long millis() { return micros() / 1000; }
+
+class __FlashStringHelper;
+#define F(s) ((const __FlashStringHelper *)PSTR(s))
+
+// Arduino's Print: everything funnels into write()
+class Print
+{
+public:
+    virtual size_t write(uint8_t c) = 0;
+
+    size_t print(const char * s)
+    {
+        size_t n = 0;
+        while(*s)
+            n += this->write(*s++);
+        return n;
+    }
+
+    size_t print(const __FlashStringHelper * s)
+    {
+        const char * p = (const char *)s;
+        size_t n = 0;
+        char c;
+        while((c = pgm_read_byte(p++)))
+            n += this->write(c);
+        return n;
+    }
+
+    size_t print(char c) { return this->write(c); }
+
+    size_t print(unsigned long value, int base = 10)
+    {
+        char digits[33];
+        uint8_t i = 0;
+        do
+        {
+            uint8_t d = value % base;
+            digits[i++] = d < 10 ? '0' + d : 'A' + d - 10;
+            value /= base;
+        }
+        while(value);
+        size_t n = 0;
+        while(i)
+            n += this->write(digits[--i]);
+        return n;
+    }
+
+    size_t print(long value, int base = 10)
+    {
+        if(value < 0)
+            return this->write('-') + this->print((unsigned long)-value, base);
+        return this->print((unsigned long)value, base);
+    }
+
+    size_t print(int value, int base = 10) { return this->print((long)value, base); }
+    size_t print(unsigned int value, int base = 10) { return this->print((unsigned long)value, base); }
+
+    size_t print(double value, int places = 2)
+    {
+        size_t n = 0;
+        if(value < 0)
+        {
+            n += this->write('-');
+            value = -value;
+        }
+        for(uint8_t i = 0; i < places; i++)
+            value *= 10;
+        unsigned long fixed = (unsigned long)(value + 0.5);
+        unsigned long scale = 1;
+        for(uint8_t i = 0; i < places; i++)
+            scale *= 10;
+        n += this->print(fixed / scale);
+        if(places)
+        {
+            n += this->write('.');
+            unsigned long fraction = fixed % scale;
+            for(unsigned long digit = scale / 10; digit > 0; digit /= 10)
+                n += this->write('0' + (fraction / digit) % 10);
+        }
+        return n;
+    }
+
+    size_t println() { return this->write('\n'); }
+    template<typename T> size_t println(T value) { return this->print(value) + this->println(); }
+    template<typename T> size_t println(T value, int format) { return this->print(value, format) + this->println(); }
+};
+
+// Writes to stdout on the host, or the simavr console on AVR (see bench.h)
+class HardwareSerial : public Print
+{
+public:
+    size_t write(uint8_t c) override;
+};
+
+extern HardwareSerial Serial;
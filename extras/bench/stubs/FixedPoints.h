@@ -0,0 +1,119 @@
+#pragma once
+
+// A small stand-in for the FixedPoints library (UFixed/SFixed), covering only what the raycaster
+// uses. Internals and rounding match the real library for the types the raycaster uses (everything
+// truncates), which is enough to count work and compare frames. To use the real library instead,
+// build with FIXEDPOINTS=path/to/FixedPoints/src (see the Makefile)
+
+#include <stdint.h>
+#include <type_traits>
+
+// The smallest unsigned/signed integers holding the given number of bits
+template<unsigned Bits>
+struct RcBenchFixedStorage
+{
+    typedef typename std::conditional<(Bits <= 8), uint8_t,
+        typename std::conditional<(Bits <= 16), uint16_t,
+        typename std::conditional<(Bits <= 32), uint32_t, uint64_t>::type>::type>::type Unsigned;
+    typedef typename std::make_signed<Unsigned>::type Signed;
+};
+
+template<unsigned I, unsigned F, bool Signed>
+class RcBenchFixed
+{
+public:
+    typedef typename std::conditional<Signed,
+        typename RcBenchFixedStorage<I + 1 + F>::Signed,
+        typename RcBenchFixedStorage<I + F>::Unsigned>::type InternalType;
+    typedef typename std::conditional<Signed,
+        typename RcBenchFixedStorage<I + 1>::Signed,
+        typename RcBenchFixedStorage<I>::Unsigned>::type IntegerType;
+    typedef typename RcBenchFixedStorage<F>::Unsigned FractionType;
+
+    static constexpr unsigned long long SCALE = 1ull << F;
+
+    InternalType value;
+
+    constexpr RcBenchFixed() : value(0) { }
+    constexpr RcBenchFixed(double d) : value((InternalType)(d * (double)SCALE)) { }
+    constexpr RcBenchFixed(float d) : value((InternalType)(d * (double)SCALE)) { }
+    constexpr RcBenchFixed(int8_t i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(uint8_t i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(int16_t i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(uint16_t i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(int i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(unsigned i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(long i) : value((InternalType)((long long)i << F)) { }
+    constexpr RcBenchFixed(unsigned long i) : value((InternalType)((long long)i << F)) { }
+
+    // Between fixed types, keep as many fraction bits as fit
+    template<unsigned I2, unsigned F2, bool Signed2>
+    explicit constexpr RcBenchFixed(const RcBenchFixed<I2, F2, Signed2> & other) :
+        value((InternalType)(F2 > F ?
+            (long long)other.value >> (F2 > F ? F2 - F : 0) :
+            (long long)other.value << (F > F2 ? F - F2 : 0))) { }
+
+    static constexpr RcBenchFixed fromInternal(InternalType internal)
+    {
+        return RcBenchFixed(internal, 0);
+    }
+
+    constexpr InternalType getInternal() const { return this->value; }
+    constexpr IntegerType getInteger() const { return (IntegerType)(this->value >> F); }
+    constexpr FractionType getFraction() const { return (FractionType)(this->value & (SCALE - 1)); }
+
+    explicit constexpr operator float() const { return (float)this->value / SCALE; }
+    explicit constexpr operator double() const { return (double)this->value / SCALE; }
+    explicit constexpr operator int8_t() const { return (int8_t)this->getInteger(); }
+    explicit constexpr operator uint8_t() const { return (uint8_t)this->getInteger(); }
+    explicit constexpr operator int16_t() const { return (int16_t)this->getInteger(); }
+    explicit constexpr operator uint16_t() const { return (uint16_t)this->getInteger(); }
+    explicit constexpr operator int() const { return (int)this->getInteger(); }
+    explicit constexpr operator unsigned() const { return (unsigned)this->getInteger(); }
+    explicit constexpr operator long() const { return (long)this->getInteger(); }
+    explicit constexpr operator unsigned long() const { return (unsigned long)this->getInteger(); }
+
+    friend constexpr RcBenchFixed operator+(RcBenchFixed a, RcBenchFixed b) { return fromInternal(a.value + b.value); }
+    friend constexpr RcBenchFixed operator-(RcBenchFixed a, RcBenchFixed b) { return fromInternal(a.value - b.value); }
+    friend constexpr RcBenchFixed operator*(RcBenchFixed a, RcBenchFixed b) { return fromInternal((InternalType)(((long long)a.value * b.value) >> F)); }
+    friend constexpr RcBenchFixed operator/(RcBenchFixed a, RcBenchFixed b) { return fromInternal((InternalType)(((long long)a.value << F) / b.value)); }
+    constexpr RcBenchFixed operator-() const { return fromInternal(-this->value); }
+
+    RcBenchFixed & operator+=(RcBenchFixed b) { this->value += b.value; return *this; }
+    RcBenchFixed & operator-=(RcBenchFixed b) { this->value -= b.value; return *this; }
+    RcBenchFixed & operator*=(RcBenchFixed b) { *this = *this * b; return *this; }
+
+    friend constexpr bool operator<(RcBenchFixed a, RcBenchFixed b) { return a.value < b.value; }
+    friend constexpr bool operator>(RcBenchFixed a, RcBenchFixed b) { return a.value > b.value; }
+    friend constexpr bool operator<=(RcBenchFixed a, RcBenchFixed b) { return a.value <= b.value; }
+    friend constexpr bool operator>=(RcBenchFixed a, RcBenchFixed b) { return a.value >= b.value; }
+    friend constexpr bool operator==(RcBenchFixed a, RcBenchFixed b) { return a.value == b.value; }
+    friend constexpr bool operator!=(RcBenchFixed a, RcBenchFixed b) { return a.value != b.value; }
+
+private:
+    constexpr RcBenchFixed(InternalType internal, int) : value(internal) { }
+};
+
+// Comparing different fixed types goes through double, which is exact for everything used here
+#define RCBENCHMIXEDCOMPARE(op) \
+    template<unsigned I1, unsigned F1, bool S1, unsigned I2, unsigned F2, bool S2, \
+        typename std::enable_if<(I1 != I2 || F1 != F2 || S1 != S2), int>::type = 0> \
+    constexpr bool operator op(RcBenchFixed<I1, F1, S1> a, RcBenchFixed<I2, F2, S2> b) \
+    { \
+        return (double)a op (double)b; \
+    }
+RCBENCHMIXEDCOMPARE(<)
+RCBENCHMIXEDCOMPARE(>)
+RCBENCHMIXEDCOMPARE(<=)
+RCBENCHMIXEDCOMPARE(>=)
+#undef RCBENCHMIXEDCOMPARE
+
+template<unsigned I, unsigned F> using UFixed = RcBenchFixed<I, F, false>;
+template<unsigned I, unsigned F> using SFixed = RcBenchFixed<I, F, true>;
+
+template<unsigned I, unsigned F, bool Signed>
+RcBenchFixed<I, F, Signed> floorFixed(RcBenchFixed<I, F, Signed> x)
+{
+    typedef typename RcBenchFixed<I, F, Signed>::InternalType Internal;
+    return RcBenchFixed<I, F, Signed>::fromInternal(x.getInternal() & ~(Internal)(RcBenchFixed<I, F, Signed>::SCALE - 1));
+}
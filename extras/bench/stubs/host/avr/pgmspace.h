@@ -0,0 +1,14 @@
+#pragma once
+
+// Host builds have no separate program memory, so progmem is just memory
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(a) (*(const uint8_t *)(a))
+#define pgm_read_word(a) (*(const uint16_t *)(a))
+#define pgm_read_dword(a) (*(const uint32_t *)(a))
+#define pgm_read_ptr(a) (*(void * const *)(a))
+#define memcpy_P memcpy
@@ -0,0 +1,205 @@
+// Checks RCBOUNDSINDEX against a plain scan of every bounds. A group of 40 bounds (so some are
+// past the 32 the index covers) goes through random adds, moves, deletes, sprite links, and
+// bounds deactivated or moved directly without telling the index, and after every change
+// firstColliding is compared with the plain scan at random points. Then times moveBounds, which
+// only touches the rows + columns the bounds covers, and firstColliding against the plain scan
+// with 64 bounds spread over the map.
+// Fails if firstColliding ever returns a different bounds than the plain scan.
+
+#ifndef RCBOUNDSINDEX
+#define RCBOUNDSINDEX
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+constexpr uint8_t NUMBOUNDS = 40;
+constexpr uint16_t CHANGES = 4000;
+constexpr uint8_t POINTS = 16;
+constexpr uint16_t MOVES = 1000;
+constexpr uint8_t BOXES = 37;
+constexpr uint8_t TIMEDBOUNDS = 64;
+constexpr uint16_t QUERIES = 4096;
+
+RcSprite<1> spritesBuffer[NUMBOUNDS];
+RcBounds boundsBuffer[NUMBOUNDS];
+RcSpriteGroup<1> group;
+RcSprite<1> timedSprites[TIMEDBOUNDS];
+RcBounds timedBounds[TIMEDBOUNDS];
+
+// What firstColliding should return: the first active bounds (by ID) matching the statemask
+RcBounds * scanColliding(RcSpriteGroup<1> * group, uflot x, uflot y, uint8_t statemask)
+{
+    for(uint8_t i = 0; i < group->numbounds; i++)
+    {
+        RcBounds * bounds = group->bounds + i;
+        if(bounds->isActive() && (!statemask || (bounds->state & statemask)) && bounds->colliding(x, y))
+            return bounds;
+    }
+    return NULL;
+}
+
+muflot randomCoord()
+{
+    return muflot::fromInternal(random(0x100));
+}
+
+// A random box of up to 2 tiles a side, within the 16x16 area
+void randomBox(muflot * x1, muflot * y1, muflot * x2, muflot * y2)
+{
+    uint8_t x = random(0xE0);
+    uint8_t y = random(0xE0);
+    *x1 = muflot::fromInternal(x);
+    *y1 = muflot::fromInternal(y);
+    *x2 = muflot::fromInternal(min(0xFF, x + 1 + random(0x20)));
+    *y2 = muflot::fromInternal(min(0xFF, y + 1 + random(0x20)));
+}
+
+void randomChange()
+{
+    RcBounds * bounds = group.bounds + random(NUMBOUNDS);
+    muflot x1, y1, x2, y2;
+    randomBox(&x1, &y1, &x2, &y2);
+
+    switch(random(7))
+    {
+        case 0:
+        case 1:
+            group.addBounds(x1, y1, x2, y2, random(2));
+            break;
+        case 2:
+            if(bounds->isActive())
+                group.moveBounds(bounds, x1, y1, x2, y2);
+            break;
+        case 3:
+            if(bounds->isActive())
+                group.deleteBounds(bounds);
+            break;
+        case 4:
+        {
+            RcSprite<1> * sprite = group.sprites + random(NUMBOUNDS);
+            if(bounds->isActive())
+                group.linkSpriteBounds(sprite, bounds);
+            break;
+        }
+        case 5:
+            // Deactivated without the index knowing
+            bounds->setActive(false);
+            break;
+        case 6:
+            // Moved without the index knowing, then fixed up the documented way
+            if(bounds->isActive())
+            {
+                uint8_t index = bounds - group.bounds;
+                group.unindexBounds(index);
+                bounds->x1 = x1;
+                bounds->y1 = y1;
+                bounds->x2 = x2;
+                bounds->y2 = y2;
+                group.indexBounds(index);
+            }
+            break;
+    }
+}
+
+// Time firstColliding with 64 sprite sized bounds spread over the map (the first 32 indexed, the
+// rest scanned) against the plain scan, which is what firstColliding does without RCBOUNDSINDEX
+bool timeColliding()
+{
+    RcSpriteGroup<1> timed;
+    timed.sprites = timedSprites;
+    timed.bounds = timedBounds;
+    timed.numsprites = TIMEDBOUNDS;
+    timed.numbounds = TIMEDBOUNDS;
+    timed.resetAll();
+    for(uint8_t i = 0; i < TIMEDBOUNDS; i++)
+    {
+        muflot x = muflot::fromInternal(random(0xF0));
+        muflot y = muflot::fromInternal(random(0xF0));
+        timed.addBounds(x, y, x + muflot::fromInternal(8), y + muflot::fromInternal(8), true);
+    }
+
+    // Half the points inside some bounds (the middle), half anywhere
+    uflot points[POINTS][2];
+    for(uint8_t p = 0; p < POINTS; p++)
+    {
+        RcBounds * bounds = timed.bounds + random(TIMEDBOUNDS);
+        points[p][0] = (p & 1) ? (uflot)randomCoord() : (uflot)bounds->x1 + uflot::fromInternal(0x40);
+        points[p][1] = (p & 1) ? (uflot)randomCoord() : (uflot)bounds->y1 + uflot::fromInternal(0x40);
+    }
+
+    // Both must agree, and the results are summed so neither loop can be dropped
+    uint32_t indexedTime = 0xFFFFFFFF, scanTime = 0xFFFFFFFF;
+    uint16_t indexedHits = 0, scanHits = 0;
+    for(uint8_t repeat = 0; repeat < BENCHREPEAT; repeat++)
+    {
+        indexedHits = scanHits = 0;
+        uint32_t start = benchTime();
+        for(uint16_t q = 0; q < QUERIES; q++)
+            indexedHits += timed.firstColliding(points[q % POINTS][0], points[q % POINTS][1], 0) != NULL;
+        indexedTime = min(indexedTime, benchTime() - start);
+
+        start = benchTime();
+        for(uint16_t q = 0; q < QUERIES; q++)
+            scanHits += scanColliding(&timed, points[q % POINTS][0], points[q % POINTS][1], 0) != NULL;
+        scanTime = min(scanTime, benchTime() - start);
+    }
+
+    benchReport(F("timed_bounds"), TIMEDBOUNDS);
+    benchReport(F("timed_hits"), indexedHits);
+    benchReport(F("first_colliding_per_1000_" BENCHTIMEUNIT), 1000.0 * indexedTime / QUERIES);
+    benchReport(F("plain_scan_per_1000_" BENCHTIMEUNIT), 1000.0 * scanTime / QUERIES);
+    return indexedHits == scanHits;
+}
+
+int benchRun()
+{
+    randomSeed(1);
+    group.sprites = spritesBuffer;
+    group.bounds = boundsBuffer;
+    group.numsprites = NUMBOUNDS;
+    group.numbounds = NUMBOUNDS;
+    group.resetAll();
+
+    uint32_t checks = 0;
+    uint32_t mismatches = 0;
+    uint32_t hits = 0;
+    for(uint16_t c = 0; c < CHANGES; c++)
+    {
+        randomChange();
+        if(c == CHANGES / 2)
+            group.reindexBounds();
+
+        for(uint8_t p = 0; p < POINTS; p++)
+        {
+            uflot x = (uflot)randomCoord();
+            uflot y = (uflot)randomCoord();
+            uint8_t statemask = random(2) ? RBSTATESOLID : 0;
+            RcBounds * expected = scanColliding(&group, x, y, statemask);
+            if(group.firstColliding(x, y, statemask) != expected)
+                mismatches++;
+            if(expected)
+                hits++;
+            checks++;
+        }
+    }
+
+    benchReport(F("checks"), checks);
+    benchReport(F("hits"), hits);
+    benchReport(F("mismatches"), mismatches);
+
+    // Fill the index, then time moving bounds around a set of boxes picked beforehand
+    muflot boxes[BOXES][4];
+    for(uint8_t b = 0; b < BOXES; b++)
+        randomBox(&boxes[b][0], &boxes[b][1], &boxes[b][2], &boxes[b][3]);
+    while(group.addBounds(0, 0, 1, 1, true)) { }
+    uint32_t start = benchTime();
+    for(uint16_t m = 0; m < MOVES; m++)
+    {
+        muflot * box = boxes[m % BOXES];
+        group.moveBounds(group.bounds + (m & 31), box[0], box[1], box[2], box[3]);
+    }
+    benchReportAverage(F("move_bounds_" BENCHTIMEUNIT), benchTime() - start, MOVES);
+
+    return mismatches || !timeColliding() ? 1 : 0;
+}
@@ -0,0 +1,141 @@
+// Checks RcMapPager's margin against what the raycaster really reads. The window is placed in the
+// middle of a bigger map whose outside cells count every read; then for each light intensity the
+// pager accepts, the walls are cast from every position the margin allows (corners of the tile
+// included) in 32 directions, over an empty window so every ray goes the full view distance.
+// Fails if:
+// - Any ray reads a cell outside the window
+// - setViewDistance accepts a view distance that doesn't fit the window (or rejects one that does)
+
+#ifndef RCLARGEMAP
+#define RCLARGEMAP
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t PAD = 16;
+constexpr uint8_t DIRECTIONS = 32;
+
+// A window sized map inside PAD cells of padding on every side. The window is empty and the
+// padding is solid (so rays stop there), and every read of the padding is counted
+template<uint8_t Size>
+struct CheckedMap
+{
+    static constexpr uint8_t STRIDE = Size + 2 * PAD;
+
+    uint8_t width = STRIDE;     // The raycaster steps rows by width
+    uint8_t height = STRIDE;
+    uint32_t outside = 0;
+
+    inline rcmapindex getIndex(uint8_t x, uint8_t y)
+    {
+        return (rcmapindex)(y + PAD) * STRIDE + x + PAD;
+    }
+
+    inline uint8_t getTile(rcmapindex index)
+    {
+        uint8_t x = index % STRIDE;
+        uint8_t y = index / STRIDE;
+        if(index >= STRIDE * STRIDE || x < PAD || y < PAD || x >= PAD + Size || y >= PAD + Size)
+        {
+            this->outside++;
+            return 1;
+        }
+        return RCEMPTY;
+    }
+};
+
+RcRender<WIDTH, HEIGHT, RCTILESIZE> render;
+RcPlayer player;
+Arduboy2Base arduboy;
+
+// Cast from every allowed position and direction, returns how many reads left the window
+template<uint8_t Size>
+uint32_t castAll(CheckedMap<Size> * map, uint8_t margin)
+{
+    const uint8_t offsets[] = { 0, 0x80, 0xFF };
+    map->outside = 0;
+
+    for(uint8_t py = margin; py < Size - margin; py++)
+    {
+        for(uint8_t px = margin; px < Size - margin; px++)
+        {
+            for(uint8_t oy = 0; oy < sizeof(offsets); oy++)
+            {
+                for(uint8_t ox = 0; ox < sizeof(offsets); ox++)
+                {
+                    player.posX = uflot::fromInternal((px << 8) | offsets[ox]);
+                    player.posY = uflot::fromInternal((py << 8) | offsets[oy]);
+                    for(uint8_t d = 0; d < DIRECTIONS; d++)
+                    {
+                        player.initPlayerDirection(d * 6.2832f / DIRECTIONS, 1.0f);
+                        render.raycastWalls(&player, map, &arduboy);
+                    }
+                }
+            }
+        }
+    }
+
+    return map->outside;
+}
+
+template<uint8_t Size>
+bool testWindow()
+{
+    // Intensities from dim to bright, and the brightest each window size should allow
+    const float intensities[] = { 0.25f, 0.5f, 0.75f, 1.0f, 1.125f, 1.25f, 2.0f, 4.0f, 6.0f, 6.25f, 8.0f };
+    const float brightest = Size == 16 ? 1.125f : 6.0f;
+
+    uint8_t windowBuffer[Size * Size];
+    RcMap window(windowBuffer, Size, Size);
+    RcMapPager<RcProgmemMapSource> pager(RcProgmemMapSource { NULL, 0 }, &window, 256, 256);
+    CheckedMap<Size> map;
+    bool pass = true;
+
+    for(uint8_t i = 0; i < sizeof(intensities) / sizeof(intensities[0]); i++)
+    {
+        render.setLightIntensity(intensities[i]);
+        bool accepted = pager.setViewDistance(render._viewdistance);
+        bool ok = accepted == (intensities[i] <= brightest);
+        uint32_t outside = 0;
+        if(accepted)
+        {
+            outside = castAll(&map, pager.margin);
+            ok &= outside == 0;
+        }
+
+        Serial.print(F("window "));
+        Serial.print(Size);
+        Serial.print(F(" intensity "));
+        Serial.print(intensities[i]);
+        Serial.print(F(": view distance "));
+        Serial.print((float)render._viewdistance);
+        if(accepted)
+        {
+            Serial.print(F(", margin "));
+            Serial.print(pager.margin);
+            Serial.print(F(", reads outside "));
+            Serial.print(outside);
+        }
+        else
+        {
+            Serial.print(F(", rejected"));
+        }
+        Serial.println(ok ? F(" ok") : F(" FAILED"));
+        pass &= ok;
+    }
+
+    return pass;
+}
+
+int benchRun()
+{
+    render.tilesheet = tilesheet;
+    bool pass = testWindow<16>();
+    pass &= testWindow<32>();
+    return pass ? 0 : 1;
+}
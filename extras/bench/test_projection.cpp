@@ -0,0 +1,127 @@
+// Accuracy of RCINTEGERPROJECTION against the float projection it replaces. For a range of view 
+// heights (including ones that don't divide the tile size evenly) and every tile size, every 
+// distance from 1/16 to 16 tiles is projected both ways, and the rows each puts the wall on and 
+// the texel drawn on every row are compared. Fails if:
+// - The wall starts or ends more than 1 row away from the float version
+// - Any texel is further off than that 1 row accounts for
+// - The texture step differs enough to drift half a texel over the visible wall
+// - INTSTEPSCALE isn't the closest it can be to the real scale
+
+#ifndef RCINTEGERPROJECTION
+#define RCINTEGERPROJECTION
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+// calcWallLine's float path, as the renderer does it without RCINTEGERPROJECTION
+template<uint8_t H, uint8_t T>
+RcWallLine floatWallLine(uflot distance)
+{
+    typedef RcRender<WIDTH, H, T> Render;
+    RcWallLine result;
+    float invLineHeight = Render::INVHEIGHT * (float)distance;
+    UFixed<16,16> step = T * invLineHeight;
+    uint16_t lineHeight = (invLineHeight <= Render::MINLDISTANCE) ? Render::MAXLHEIGHT : (uint16_t)(1 / invLineHeight);
+
+    int16_t halfLine = lineHeight >> 1;
+    result.yStart = max(0, Render::MIDSCREENY - halfLine);
+    result.yEnd = min(H, Render::MIDSCREENY + halfLine);
+    UFixed<16,16> texPos = (result.yStart + halfLine - Render::MIDSCREENY) * step;
+    result.fullstep = step.getInteger();
+    result.accustep = (step.getFraction() >> 8);
+    result.accum = (texPos.getFraction() >> 8);
+    result.texShift = texPos.getInteger();
+    return result;
+}
+
+// The texel drawn on row y, stepping the same way drawWallLine does
+uint16_t texelAt(const RcWallLine & line, uint8_t y)
+{
+    uint32_t position = ((uint32_t)line.texShift << 8) + line.accum + 
+        (uint32_t)(y - line.yStart) * (((uint16_t)line.fullstep << 8) + line.accustep);
+    return position >> 8;
+}
+
+template<uint8_t H, uint8_t T>
+bool testProjection()
+{
+    static RcRender<WIDTH, H, T> render;
+    uint8_t worstRow = 0;
+    uint16_t worstTexel = 0;        // Beyond what the row error accounts for
+    uint16_t texelMismatches = 0;
+    uint32_t rows = 0;
+    float worstDrift = 0;           // Texels the step error adds up to over the visible wall
+
+    // The distance to step scale must be the nearest integer to the real one
+    float scaleError = fabs(RcRender<WIDTH, H, T>::INTSTEPSCALE - T * 256.0f / H);
+
+    for(uint16_t d = 16; d <= 16 * 256; d++)
+    {
+        uflot distance = uflot::fromInternal(d);
+        RcWallLine line = render.calcWallLine(distance);
+        RcWallLine reference = floatWallLine<H, T>(distance);
+
+        worstRow = max(worstRow, (uint8_t)abs((int16_t)line.yStart - reference.yStart));
+        worstRow = max(worstRow, (uint8_t)abs((int16_t)line.yEnd - reference.yEnd));
+
+        float step = ((line.fullstep << 8) + line.accustep) / 256.0f;
+        float referenceStep = ((reference.fullstep << 8) + reference.accustep) / 256.0f;
+        float drift = fabs(step - referenceStep) * (reference.yEnd - reference.yStart);
+        worstDrift = max(worstDrift, drift);
+
+        // Only compare rows both put the wall on. Being a row off is already allowed, so 
+        // that row's worth of texels is too
+        uint16_t allowed = reference.fullstep + 1;
+        for(uint8_t y = max(line.yStart, reference.yStart); y < min(line.yEnd, reference.yEnd); y++)
+        {
+            uint16_t error = abs((int16_t)texelAt(line, y) - (int16_t)texelAt(reference, y));
+            if(error)
+                texelMismatches++;
+            worstTexel = max(worstTexel, error > allowed ? error - allowed : 0);
+            rows++;
+        }
+    }
+
+    bool pass = scaleError <= 0.5f && worstRow <= 1 && worstTexel == 0 && worstDrift < 0.5f;
+    Serial.print(F("height "));
+    Serial.print(H);
+    Serial.print(F(" tile "));
+    Serial.print(T);
+    Serial.print(F(": scale error "));
+    Serial.print(scaleError, 3);
+    Serial.print(F(", worst row "));
+    Serial.print(worstRow);
+    Serial.print(F(", texels past that "));
+    Serial.print(worstTexel);
+    Serial.print(F(", step drift "));
+    Serial.print(worstDrift, 3);
+    Serial.print(F(", texels off "));
+    Serial.print(texelMismatches);
+    Serial.print('/');
+    Serial.print(rows);
+    Serial.println(pass ? F(" ok") : F(" FAIL"));
+    return pass;
+}
+
+template<uint8_t H>
+bool testHeight()
+{
+    bool pass = testProjection<H, 8>();
+    pass &= testProjection<H, 16>();
+    pass &= testProjection<H, 32>();
+    return pass;
+}
+
+int benchRun()
+{
+    bool pass = testHeight<64>();
+    pass &= testHeight<56>();
+    pass &= testHeight<48>();
+    pass &= testHeight<40>();
+    pass &= testHeight<36>();
+    pass &= testHeight<24>();
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+// Checks RCWALLSCALERS' compile time scalers for 8, 16 and 32 pixel tiles. Fails if:
+// - The table is bigger than RCWALLSCALERBUDGET, or a scaler runs past its RECORDBYTES
+// - Any row of any scaler is a different texel than the exact one for that wall height
+// - drawWallLine with a scaler draws anything else (any shading, with and without corner shading),
+//   or touches a pixel outside the wall
+// Also reports which wall heights get scalers within the budget, and how many pixels the scalers
+// draw differently from the overflow accumulator they replace (which is the inexact one)
+
+#ifndef RCWALLSCALERS
+#define RCWALLSCALERS
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+constexpr uint8_t DRAWSPERHALF = 8;
+
+// The texel a wall with the given half height should have on row y
+template<uint8_t T>
+uint8_t exactTexel(uint8_t half, uint8_t y)
+{
+    return ((y - (HEIGHT / 2 - (int16_t)half)) * T) / (2 * half);
+}
+
+// Decode every scaler back into a texel per row and compare with the exact texels
+template<uint8_t T>
+bool testTable()
+{
+    typedef RcRender<WIDTH, HEIGHT, T> Render;
+    typedef typename Render::Scaler Scaler;
+    uint16_t wrong = 0, overruns = 0;
+
+    for(uint16_t half = Render::SCALERMINHALF; half <= Render::SCALERMAXHALF; half++)
+    {
+        const uint8_t * record = Render::Scalers::data + (half - Render::SCALERMINHALF) * Scaler::RECORDBYTES;
+        const uint8_t * scaler = record;
+        uint8_t texels[HEIGHT];
+        uint8_t yStart = Scaler::yStart(half), yEnd = Scaler::yEnd(half);
+        uint8_t texel = pgm_read_byte(scaler++);
+        uint8_t lastTexel = 0;
+
+        for(uint8_t page = yStart >> 3; page <= (yEnd - 1) >> 3; page++)
+        {
+            uint8_t count = pgm_read_byte(scaler++);
+            uint8_t carry = pgm_read_byte(scaler++);
+            for(uint8_t b = 0; b < 8; b++)
+                if(carry & (1 << b)) texels[page * 8 + b] = lastTexel;
+            for(uint8_t i = 0; i < count; i++)
+            {
+                uint8_t mask = pgm_read_byte(scaler++);
+                for(uint8_t b = 0; b < 8; b++)
+                    if(mask & (1 << b)) texels[page * 8 + b] = texel;
+                lastTexel = texel++;
+            }
+        }
+
+        if(scaler > record + Scaler::RECORDBYTES)
+            overruns++;
+        for(uint8_t y = yStart; y < yEnd; y++)
+            if(texels[y] != exactTexel<T>(half, y))
+                wrong++;
+    }
+
+    bool ok = sizeof(Render::Scalers::data) <= RCWALLSCALERBUDGET && wrong == 0 && overruns == 0;
+    Serial.print(F("tile "));
+    Serial.print(T);
+    Serial.print(F(": half heights "));
+    Serial.print(Render::SCALERMINHALF);
+    Serial.print(F(".."));
+    Serial.print(Render::SCALERMAXHALF);
+    Serial.print(F(" in "));
+    Serial.print(sizeof(Render::Scalers::data));
+    Serial.print(F(" of "));
+    Serial.print(RCWALLSCALERBUDGET);
+    Serial.print(F(" bytes, wrong rows "));
+    Serial.print(wrong);
+    Serial.print(F(", overruns "));
+    Serial.print(overruns);
+    Serial.println(ok ? F(" ok") : F(" FAILED"));
+    return ok;
+}
+
+// Draw every scaler over random screens and check every pixel of the column, then compare each with
+// the same wall drawn by the accumulator
+template<uint8_t T>
+bool testDraw()
+{
+    typedef RcRender<WIDTH, HEIGHT, T> Render;
+    Render render;
+    Arduboy2Base arduboy;
+    uint8_t before[sizeof(arduboy.sBuffer)];
+    uint8_t scaled[sizeof(arduboy.sBuffer)];
+    uint32_t wrong = 0, pixels = 0, differs = 0;
+
+    for(uint16_t half = Render::SCALERMINHALF; half <= Render::SCALERMAXHALF; half++)
+    {
+        for(uint8_t i = 0; i < DRAWSPERHALF; i++)
+        {
+            RcShadeInfo shading;
+            shading.type = (i & 1) ? RcShadingType::White : RcShadingType::Black;
+            shading.shading = i < 2 ? (shading.type == RcShadingType::Black ? 0xFF : 0x00) : random(256);
+            render.cornershading = (i >> 1) & 1;
+            uint32_t texture = ((uint32_t)random(0x10000) << 16) | random(0x10000);
+            uint8_t x = random(WIDTH);
+
+            // The accumulator's line for the same height, from the distance that gives it
+            uflot distance = uflot::fromInternal(0xFFFF);
+            for(uint16_t d = 1; d < 0xFFFF; d++)
+            {
+                RcWallLine line = render.calcWallLine(uflot::fromInternal(d));
+                if(line.scaler == half - Render::SCALERMINHALF + 1)
+                {
+                    distance = uflot::fromInternal(d);
+                    break;
+                }
+            }
+            RcWallLine line = render.calcWallLine(distance);
+
+            for(uint16_t b = 0; b < sizeof(before); b++)
+                before[b] = random(256);
+            memcpy(arduboy.sBuffer, before, sizeof(before));
+            render.drawWallLine(x, line, shading, (typename Render::TexStrip)texture, &arduboy);
+            memcpy(scaled, arduboy.sBuffer, sizeof(scaled));
+
+            for(uint8_t y = 0; y < HEIGHT; y++)
+            {
+                uint16_t b = (y >> 3) * WIDTH + x;
+                uint8_t bit = 1 << (y & 7);
+                bool expected = before[b] & bit;
+                if(y >= line.yStart && y < line.yEnd)
+                {
+                    bool texel = (texture >> exactTexel<T>(half, y)) & 1;
+                    bool shade = shading.shading & bit;
+                    expected = shading.type == RcShadingType::Black ? (texel && shade) : (texel || shade);
+                }
+                else if(y == line.yEnd && (y & 7) && render.cornershading)
+                {
+                    expected = false;
+                }
+                if(expected != (bool)(scaled[b] & bit))
+                    wrong++;
+            }
+
+            memcpy(arduboy.sBuffer, before, sizeof(before));
+            line.scaler = 0;
+            render.drawWallLine(x, line, shading, (typename Render::TexStrip)texture, &arduboy);
+            for(uint8_t y = line.yStart; y < line.yEnd; y++)
+            {
+                uint16_t b = (y >> 3) * WIDTH + x;
+                uint8_t bit = 1 << (y & 7);
+                if((scaled[b] ^ arduboy.sBuffer[b]) & bit)
+                    differs++;
+            }
+            pixels += line.yEnd - line.yStart;
+        }
+    }
+
+    bool ok = wrong == 0;
+    Serial.print(F("tile "));
+    Serial.print(T);
+    Serial.print(F(": wall pixels "));
+    Serial.print(pixels);
+    Serial.print(F(", wrong "));
+    Serial.print(wrong);
+    Serial.print(F(", not what the accumulator draws "));
+    Serial.print(differs);
+    Serial.print(F(" ("));
+    Serial.print(100.0 * differs / pixels);
+    Serial.print(F("%)"));
+    Serial.println(ok ? F(" ok") : F(" FAILED"));
+    return ok;
+}
+
+int benchRun()
+{
+    randomSeed(1);
+    bool pass = testTable<8>();
+    pass &= testTable<16>();
+    pass &= testTable<32>();
+    pass &= testDraw<8>();
+    pass &= testDraw<16>();
+    pass &= testDraw<32>();
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// Checks RCSHADINGTABLE's table against the shading it replaces, for both a new renderer (which
+// has to build it for its starting light intensity) and after each setLightIntensity. At the middle
+// of every table step the table must give exactly calcShading's result, and everywhere else it may
+// only be off by the one gradient the coarser steps allow.
+// Also checks that RCWALLLOD fills a wall solid exactly when the table shades it fully, by walking
+// up to a wall facing the player through the point where it goes dark.
+
+#ifndef RCSHADINGTABLE
+#define RCSHADINGTABLE
+#endif
+#ifndef RCWALLLOD
+#define RCWALLLOD
+#endif
+#include "bench.h"
+
+#include <ArduboyRaycast.h>
+
+#include "../../examples/4_demo_regions/tilesheet.h"
+
+RCBENCHRENDERCONSTANTS(RcRender)
+
+typedef RcRender<WIDTH, HEIGHT, RCTILESIZE> Render;
+
+// The bayer gradient for a b_shading offset, BAYERGRADIENTS for fully shaded
+uint8_t offsetLevel(uint8_t offset)
+{
+    return offset == 0xFF ? BAYERGRADIENTS : offset >> 2;
+}
+
+// Compare the render's table with calcShading over every distance up to past the view distance
+bool testTable(Render * render, const __FlashStringHelper * name)
+{
+    auto & table = render->_shadeTable;
+    uint16_t middles = 0, middleErrors = 0, farErrors = 0;
+    uint16_t end = min(0xFFFF, render->_viewdistance.getInternal() * 2);
+
+    for(uint16_t d = 0; d < end; d++)
+    {
+        uflot distance = uflot::fromInternal(d);
+        uint8_t expected = min(calcShadingLevel(distance, render->_darkness), BAYERGRADIENTS);
+        uint8_t level = offsetLevel(table.offset(distance));
+
+        uint16_t halfStep = (1 << table.shift) >> 1;
+        if((d & ((1 << table.shift) - 1)) == halfStep)
+        {
+            middles++;
+            if(level != expected)
+                middleErrors++;
+        }
+        else if(abs((int8_t)level - (int8_t)expected) > 1)
+        {
+            farErrors++;
+        }
+    }
+
+    bool ok = middles > 0 && middleErrors == 0 && farErrors == 0;
+    Serial.print(name);
+    Serial.print(F(": view distance "));
+    Serial.print((float)render->_viewdistance);
+    Serial.print(F(", step middles "));
+    Serial.print(middles);
+    Serial.print(F(", wrong "));
+    Serial.print(middleErrors);
+    Serial.print(F(", off by more than a gradient "));
+    Serial.print(farErrors);
+    Serial.println(ok ? F(" ok") : F(" FAILED"));
+    return ok;
+}
+
+// Stand the player in front of a wall (so every column is the same distance away) and move back 
+// through the view distance. Every drawn column must be filled solid by RCWALLLOD exactly when the
+// table gives it no light at all. Only works while the wall fills the view past the view distance
+bool testDarkWalls(Render * render)
+{
+    uint8_t mapBuffer[RCMAXMAPDIMENSION * RCMAXMAPDIMENSION];
+    RcMap map(mapBuffer, RCMAXMAPDIMENSION, RCMAXMAPDIMENSION);
+    map.fillMap(RCEMPTY);
+    for(uint8_t i = 0; i < RCMAXMAPDIMENSION; i++)
+    {
+        map.setCell(i, 0, 1);
+        map.setCell(i, RCMAXMAPDIMENSION - 1, 1);
+        map.setCell(0, i, 1);
+        map.setCell(RCMAXMAPDIMENSION - 1, i, 1);
+    }
+
+    RcPlayer player;
+    player.posY = RCMAXMAPDIMENSION / 2;
+    player.initPlayerDirection(0, 1.0f);    // Facing the wall at the far end of x
+
+    Arduboy2Base arduboy;
+    render->tilesheet = tilesheet;
+    uint16_t frames = 0, darkFrames = 0, wrong = 0;
+    uint16_t end = render->_viewdistance.getInternal() + 256;
+
+    for(uint16_t d = 256; d < end && d < (RCMAXMAPDIMENSION - 2) * 256; d += 3)
+    {
+        player.posX = uflot::fromInternal((RCMAXMAPDIMENSION - 1) * 256 - d);
+        render->raycastWalls(&player, &map, &arduboy);
+
+        // Only while the whole view is the wall in front, not the side walls
+        auto & stats = render->stats;
+        bool flat = stats.wallColumns + stats.lodColumns == Render::VIEWWIDTH;
+        for(uint8_t i = 1; i < Render::VIEWWIDTH / 2; i++)
+            flat &= render->_distCache[i] == render->_distCache[0];
+        if(!flat)
+            continue;
+        bool dark = render->_shadeTable.offset(render->_distCache[0]) == 0xFF;
+        frames++;
+        darkFrames += dark;
+        if(stats.lodColumns != (dark ? stats.wallColumns + stats.lodColumns : 0))
+            wrong++;
+    }
+
+    bool ok = darkFrames > 0 && darkFrames < frames && wrong == 0;
+    Serial.print(F("dark walls: view distance "));
+    Serial.print((float)render->_viewdistance);
+    Serial.print(F(", frames "));
+    Serial.print(frames);
+    Serial.print(F(", dark "));
+    Serial.print(darkFrames);
+    Serial.print(F(", filled wrong "));
+    Serial.print(wrong);
+    Serial.println(ok ? F(" ok") : F(" FAILED"));
+    return ok;
+}
+
+int benchRun()
+{
+    Render render;
+    bool pass = testTable(&render, F("new renderer"));
+    pass &= testDarkWalls(&render);
+
+    const float intensities[] = { 0.25f, 0.5f, 1.5f, 2.0f, 4.0f, 1.0f };
+    for(uint8_t i = 0; i < sizeof(intensities) / sizeof(intensities[0]); i++)
+    {
+        render.setLightIntensity(intensities[i]);
+        pass &= testTable(&render, F("setLightIntensity"));
+        if(render._viewdistance < RCMAXMAPDIMENSION / 2 - 2)
+            pass &= testDarkWalls(&render);
+    }
+
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,83 @@
+// Rewrites the sprite sheets in a generated fxdata .bin as one interleaved sheet, for sketches
+// built with RCFXINTERLEAVEDSPRITES. raycast_helper writes the mask right after the sprite data,
+// so the interleaved sheet fits exactly where both were: the sketch keeps using the spritesheet
+// address from fxdata.h (the mask address is then unused). Build and run it on your PC:
+//
+//   g++ -O2 fxinterleave.cpp -o fxinterleave
+//   fxinterleave fxdata.bin spritesheet spritesheetMask frames layout [out.bin]
+//
+// Addresses and frames are from fxdata.h (0x prefixed hex is fine), layout is 32, 32no4 or 16
+// (RcFxLayout32, RcFxLayout32No4, RcFxLayout16). Without out.bin, fxdata.bin is rewritten. For
+// example 7_fx: fxinterleave fxdata/fxdata_dev.bin 0x0002B0 0x000560 4 32
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fxinterleave.h"
+
+int main(int argc, char ** argv)
+{
+    if(argc < 6 || argc > 7)
+    {
+        fprintf(stderr, "usage: %s fxdata.bin spritesheet spritesheetMask frames layout [out.bin]\n", argv[0]);
+        return 1;
+    }
+
+    const char * input = argv[1];
+    const char * output = argc > 6 ? argv[6] : argv[1];
+    unsigned long sheetAddress = strtoul(argv[2], NULL, 0);
+    unsigned long maskAddress = strtoul(argv[3], NULL, 0);
+    unsigned long frames = strtoul(argv[4], NULL, 0);
+
+    const uint8_t * levels;
+    if(!strcmp(argv[5], "32")) levels = FXLEVELS32;
+    else if(!strcmp(argv[5], "32no4")) levels = FXLEVELS32NO4;
+    else if(!strcmp(argv[5], "16")) levels = FXLEVELS16;
+    else
+    {
+        fprintf(stderr, "unknown layout %s, use 32, 32no4 or 16\n", argv[5]);
+        return 1;
+    }
+
+    unsigned long sheetBytes = frames * fxFrameBytes(levels);
+    if(frames == 0 || maskAddress != sheetAddress + sheetBytes)
+    {
+        fprintf(stderr, "the mask must directly follow the %lu bytes of sprite data (expected it at 0x%06lX)\n",
+            sheetBytes, sheetAddress + sheetBytes);
+        return 1;
+    }
+
+    FILE * file = fopen(input, "rb");
+    if(!file)
+    {
+        perror(input);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    uint8_t * data = (uint8_t *)malloc(size);
+    uint8_t * interleaved = (uint8_t *)malloc(2 * sheetBytes);
+    bool read = data && interleaved && fread(data, 1, size, file) == (size_t)size;
+    fclose(file);
+    if(!read || maskAddress + sheetBytes > (unsigned long)size)
+    {
+        fprintf(stderr, "couldn't read both sheets from %s\n", input);
+        return 1;
+    }
+
+    fxInterleaveSprites(data + sheetAddress, data + maskAddress, frames, levels, interleaved);
+    memcpy(data + sheetAddress, interleaved, 2 * sheetBytes);
+
+    file = fopen(output, "wb");
+    if(!file || fwrite(data, 1, size, file) != (size_t)size)
+    {
+        perror(output);
+        return 1;
+    }
+    fclose(file);
+
+    printf("interleaved %lu frames (%lu bytes) at 0x%06lX\n", frames, 2 * sheetBytes, sheetAddress);
+    return 0;
+}
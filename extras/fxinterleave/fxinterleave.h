@@ -0,0 +1,50 @@
+#pragma once
+
+// Turns the two FX sprite sheets (data + mask, as written by raycast_helper) into the single
+// interleaved sheet RCFXINTERLEAVEDSPRITES expects (see "Interleaved sprites" in the readme). A
+// frame is every mipmap level, largest first, and each level is its stripes left to right; a
+// stripe is width / 8 bytes (at least 1). The interleaved frame is each stripe's data bytes
+// followed by its mask bytes, so it's twice the size. Used by fxinterleave.cpp, and by bench_fx to
+// check the interleaved sheet draws exactly what the two sheets do.
+
+#include <stdint.h>
+
+// Level widths for the layouts in ArduboyRaycast_RenderFX.h, largest first and 0 terminated
+constexpr uint8_t FXLEVELS32[] = { 32, 16, 8, 4, 0 };
+constexpr uint8_t FXLEVELS32NO4[] = { 32, 16, 8, 0 };
+constexpr uint8_t FXLEVELS16[] = { 16, 8, 4, 0 };
+
+inline uint8_t fxStripeBytes(uint8_t width)
+{
+    return width < 8 ? 1 : width >> 3;
+}
+
+// Bytes in one frame of ONE of the regular sheets (the layout's FRAMEBYTES)
+inline uint16_t fxFrameBytes(const uint8_t * levels)
+{
+    uint16_t bytes = 0;
+    for(; *levels; levels++)
+        bytes += *levels * fxStripeBytes(*levels);
+    return bytes;
+}
+
+// Interleave frames worth of sheet + mask into out, which must hold 2 * frames * fxFrameBytes
+inline void fxInterleaveSprites(const uint8_t * sheet, const uint8_t * mask, uint16_t frames, const uint8_t * levels, uint8_t * out)
+{
+    uint32_t in = 0;
+    for(uint16_t f = 0; f < frames; f++)
+    {
+        for(const uint8_t * level = levels; *level; level++)
+        {
+            uint8_t bytes = fxStripeBytes(*level);
+            for(uint8_t stripe = 0; stripe < *level; stripe++)
+            {
+                for(uint8_t i = 0; i < bytes; i++)
+                    *out++ = sheet[in + i];
+                for(uint8_t i = 0; i < bytes; i++)
+                    *out++ = mask[in + i];
+                in += bytes;
+            }
+        }
+    }
+}
@@ -1,53 +1,147 @@
-#pragma once
-
-#include <Arduboy2.h>
-#include "ArduboyRaycast_RenderFX.h"
-
-template <uint8_t SpriteCount, uint8_t InternalStateBytes, uint8_t ScreenWidth, uint8_t ScreenHeight>
-class RcContainer
-{
-public:
-    RcSprite<InternalStateBytes> spritesBuffer[SpriteCount];
-    SSprite<InternalStateBytes> sortedBuffer[SpriteCount];
-    RcBounds boundsBuffer[SpriteCount];
-    RcSpriteGroup<InternalStateBytes> sprites;
-
-    uint8_t mapBuffer[RCMAXMAPDIMENSION * RCMAXMAPDIMENSION];
-    RcPlayer player;
-    RcMap worldMap;
-
-    RcRender<ScreenWidth, ScreenHeight> render;
-
-    RcContainer(const uint24_t tilesheet, const uint24_t spritesheet, const uint24_t spritesheet_mask) 
-    {
-        sprites.sprites = this->spritesBuffer;
-        sprites.sortedSprites = this->sortedBuffer;
-        sprites.bounds = this->boundsBuffer;
-        sprites.numbounds = SpriteCount;
-        sprites.numsprites = SpriteCount;
-
-        worldMap.map = this->mapBuffer;
-        worldMap.width = RCMAXMAPDIMENSION;
-        worldMap.height = RCMAXMAPDIMENSION;
-
-        // Start in the upper corner
-        player.posX = 1.5;
-        player.posY = 1.5;
-        player.dirX = 0;
-        player.dirY = 1;
-
-        render.tilesheet = tilesheet;
-        render.spritesheet = spritesheet;
-        render.spritesheet_mask = spritesheet_mask;
-    }
-
-    void runIteration(Arduboy2Base * arduboy)
-    {
-        this->render.raycastWalls(&this->player, &this->worldMap, arduboy);
-        if(this->render.spritesheet)
-        {
-            this->sprites.runSprites();
-            this->render.drawSprites(&this->player, &this->sprites, arduboy);
-        }
-    }
+#pragma once
+
+#include <Arduboy2.h>
+#include "ArduboyRaycast_RenderFX.h"
+
+// Layout must match how your fxdata was generated, see RcFxLayout32
+// MapType is the worldMap type. The default RcMap lives in mapBuffer (256 bytes of RAM); use
+// RcProgmemMap to render read-only levels straight from progmem without it (see RcMapBuffer)
+template <uint8_t SpriteCount, uint8_t InternalStateBytes, uint8_t ScreenWidth, uint8_t ScreenHeight, typename Layout = RcFxLayout32, typename MapType = RcMap>
+class RcContainer : public RcMapBuffer<MapType>
+{
+public:
+    // Everything outside the map that changes what a frame looks like
+    struct DrawState
+    {
+        uflot posX;
+        uflot posY;
+        float dirX;
+        float dirY;
+        uflot lightintensity;
+        RcShadingType shading;
+        RcShadingType altWallShading;
+        RcShadingType spriteShading;
+        uint8_t cornershading;
+        uint16_t spriteHash;
+        const uint8_t * bg;
+        uint24_t tilesheet;
+        uint24_t spritesheet;
+        uint24_t spritesheet_mask;
+        muflot spritescaling[4];
+    };
+
+    RcSprite<InternalStateBytes> spritesBuffer[SpriteCount];
+    SSprite<InternalStateBytes> sortedBuffer[SpriteCount];
+    RcBounds boundsBuffer[SpriteCount];
+    RcSpriteGroup<InternalStateBytes> sprites;
+
+    RcPlayer player;
+    MapType worldMap;
+
+    RcRender<ScreenWidth, ScreenHeight, Layout> render;
+
+    DrawState lastDrawState;
+    bool forceDraw = true;
+
+    RcContainer(const uint24_t tilesheet, const uint24_t spritesheet, const uint24_t spritesheet_mask) 
+    {
+        sprites.sprites = this->spritesBuffer;
+        sprites.sortedSprites = this->sortedBuffer;
+        sprites.bounds = this->boundsBuffer;
+        sprites.numbounds = SpriteCount;
+        sprites.numsprites = SpriteCount;
+
+        this->attachMap(&this->worldMap);
+
+        // Start in the upper corner
+        player.posX = 1.5;
+        player.posY = 1.5;
+        player.dirX = 0;
+        player.dirY = 1;
+
+        render.tilesheet = tilesheet;
+        render.spritesheet = spritesheet;
+        render.spritesheet_mask = spritesheet_mask;
+    }
+
+    void runIteration(Arduboy2Base * arduboy)
+    {
+        this->render.raycastWalls(&this->player, &this->worldMap, arduboy);
+        if(this->render.spritesheet)
+        {
+            this->sprites.runSprites();
+            this->render.drawSprites(&this->player, &this->sprites, arduboy);
+        }
+        #ifdef RCPROFILE
+        this->render.profiler.endFrame();
+        #endif
+    }
+
+    // Force the next runIterationIfChanged to draw. checkChanged can't see these, so call this 
+    // after any of them: drawing over the raycast area yourself, changing what's in the fxdata or 
+    // the background (rather than which one is used), changing the map without going through the
+    // map (so changed isn't set), or if the sprites must never hit drawHash's rare collisions
+    inline void invalidate()
+    {
+        this->forceDraw = true;
+    }
+
+    // Check whether anything that affects the frame changed since the last time this returned true:
+    // the player, the map, the sprites (see drawHash), bg, and every render setting (sheets,
+    // shading, light, sprite scaling). See invalidate for what it can't see
+    bool checkChanged(const uint8_t * bg = NULL)
+    {
+        DrawState state;
+        memset(&state, 0, sizeof(DrawState)); // Padding must compare equal
+        state.posX = this->player.posX;
+        state.posY = this->player.posY;
+        state.dirX = this->player.dirX;
+        state.dirY = this->player.dirY;
+        state.lightintensity = this->render.lightintensity;
+        state.shading = this->render.shading;
+        state.altWallShading = this->render.altWallShading;
+        state.spriteShading = this->render.spriteShading;
+        state.cornershading = this->render.cornershading;
+        state.spriteHash = this->render.spritesheet ? this->sprites.drawHash() : 0;
+        state.bg = bg;
+        state.tilesheet = this->render.tilesheet;
+        state.spritesheet = this->render.spritesheet;
+        state.spritesheet_mask = this->render.spritesheet_mask;
+        memcpy(state.spritescaling, this->render.spritescaling, sizeof(state.spritescaling));
+
+        bool changed = this->forceDraw || this->worldMap.changed || memcmp(&state, &this->lastDrawState, sizeof(DrawState));
+
+        if(changed)
+        {
+            this->lastDrawState = state;
+            this->worldMap.changed = false;
+            this->forceDraw = false;
+        }
+
+        return changed;
+    }
+
+    // Like runIteration, but skips drawing entirely when nothing changed since the last frame, 
+    // leaving the previous frame in the screen buffer. Because of that, the background is drawn 
+    // here (so pass it in instead of drawing it yourself) and you must not clear the screen 
+    // between frames. Sprite behaviors still run every frame. Returns whether anything was drawn.
+    // When only sprites moved, the walls are still redrawn: keeping them to draw sprites over 
+    // would need a second screen sized buffer (1KB of the Arduboy's 2.5KB of RAM)
+    bool runIterationIfChanged(Arduboy2Base * arduboy, const uint8_t * bg)
+    {
+        if(this->render.spritesheet)
+            this->sprites.runSprites();
+
+        if(!this->checkChanged(bg))
+            return false;
+
+        this->render.drawRaycastBackground(arduboy, bg);
+        this->render.raycastWalls(&this->player, &this->worldMap, arduboy);
+        if(this->render.spritesheet)
+            this->render.drawSprites(&this->player, &this->sprites, arduboy);
+        #ifdef RCPROFILE
+        this->render.profiler.endFrame();
+        #endif
+        return true;
+    }
 };
\ No newline at end of file
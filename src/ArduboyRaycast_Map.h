@@ -1,47 +1,370 @@
-#pragma once
-
-#include <Arduboy2.h>
-#include <FixedPoints.h>
-
-#include "ArduboyRaycast_Utils.h"
-
-constexpr uint8_t RCMAXMAPDIMENSION = 16;
-
-// A single raycast map
-class RcMap 
-{
-public:
-    uint8_t * map;
-    uint8_t width;
-    uint8_t height;
-
-    void setCell(uint8_t x, uint8_t y, uint8_t tile)
-    {
-        this->map[this->getIndex(x, y)] = tile;
-    }
-
-    // Fill map with all of the given tile
-    void fillMap(uint8_t tile)
-    {
-        memset(this->map, tile, size_t(this->width * this->height));
-    }
-
-    // Draw the given maze starting at the given screen x + y
-    void drawMap(Arduboy2Base * arduboy, uint8_t x, uint8_t y)
-    {
-        //This is INCREDIBLY slow but should be fine
-        for(uint8_t i = 0; i < this->height; ++i)
-            for(uint8_t j = 0; j < this->width; ++j)
-                arduboy->drawPixel(x + j, y + i, this->getCell(j, this->height - i - 1) ? WHITE : BLACK);
-    }
-
-    inline uint8_t getIndex(uint8_t x, uint8_t y)
-    {
-        return y * this->width + x;
-    }
-
-    inline uint8_t getCell(uint8_t x, uint8_t y)
-    {
-        return this->map[this->getIndex(x, y)];
-    }
-};
+#pragma once
+
+#include <Arduboy2.h>
+#include <FixedPoints.h>
+
+#include "ArduboyRaycast_Utils.h"
+
+constexpr uint8_t RCMAXMAPDIMENSION = 16;
+
+// Map indices (y * width + x) only fit in a byte for maps up to 16x16. RCLARGEMAP makes them 16 bit,
+// which costs a little in the DDA loop but allows larger maps (see RcMapPager for really large worlds)
+#ifdef RCLARGEMAP
+typedef uint16_t rcmapindex;
+typedef int16_t rcmapstep;
+#else
+typedef uint8_t rcmapindex;
+typedef int8_t rcmapstep;
+#endif
+
+// A single raycast map
+class RcMap 
+{
+public:
+    uint8_t * map = NULL;
+    uint8_t width = 0;
+    uint8_t height = 0;
+    bool changed = true;    // Set whenever the map is modified through this class. If you write to 'map' directly, call markChanged()
+
+    RcMap() { }
+    RcMap(uint8_t * map, uint8_t width, uint8_t height) : map(map), width(width), height(height) { }
+
+    // Always returns true; the other map types can refuse some tiles, so generic code (like 
+    // decodeRleMap) checks this
+    bool setCell(uint8_t x, uint8_t y, uint8_t tile)
+    {
+        this->map[this->getIndex(x, y)] = tile;
+        this->changed = true;
+        return true;
+    }
+
+    // Fill map with all of the given tile
+    void fillMap(uint8_t tile)
+    {
+        memset(this->map, tile, size_t(this->width * this->height));
+        this->changed = true;
+    }
+
+    inline void markChanged()
+    {
+        this->changed = true;
+    }
+
+    // Draw the given maze starting at the given screen x + y
+    void drawMap(Arduboy2Base * arduboy, uint8_t x, uint8_t y)
+    {
+        //This is INCREDIBLY slow but should be fine
+        for(uint8_t i = 0; i < this->height; ++i)
+            for(uint8_t j = 0; j < this->width; ++j)
+                arduboy->drawPixel(x + j, y + i, this->getCell(j, this->height - i - 1) ? WHITE : BLACK);
+    }
+
+    inline rcmapindex getIndex(uint8_t x, uint8_t y)
+    {
+        return (rcmapindex)y * this->width + x;
+    }
+
+    inline uint8_t getCell(uint8_t x, uint8_t y)
+    {
+        return this->map[this->getIndex(x, y)];
+    }
+
+    // Get the tile at a raw index (from getIndex). This is what the raycaster uses
+    inline uint8_t getTile(rcmapindex index)
+    {
+        return this->map[index];
+    }
+};
+
+// A raycast map which stores each cell in 2 or 4 bits instead of a whole byte. Each cell is an 
+// index into a small palette of real tiles, so a map can only use 4 (or 16) distinct tiles, 
+// including empty. Cells are still O(1) to read, but each read costs a shift, a mask and a 
+// palette lookup, so raycasting is a bit slower than with RcMap. The buffer must be at least
+// (width * height * Bits + 7) / 8 bytes.
+template<uint8_t Bits>
+class RcPackedMap
+{
+public:
+    static_assert(Bits == 2 || Bits == 4, "RcPackedMap only supports 2 or 4 bits per cell");
+
+    static constexpr uint8_t PALETTESIZE = 1 << Bits;
+    static constexpr uint8_t CELLMASK = PALETTESIZE - 1;
+    static constexpr uint8_t INDEXSHIFT = Bits == 4 ? 1 : 2;        // Index to byte
+    static constexpr uint8_t SUBINDEXMASK = (1 << INDEXSHIFT) - 1;  // Index to cell within byte
+
+    uint8_t * map = NULL;
+    uint8_t palette[PALETTESIZE];   // Palette index to tile. Index 0 is used by fillMap(RCEMPTY), so keep it empty
+    uint8_t width = 0;
+    uint8_t height = 0;
+    bool changed = true;
+
+    // Set the cell at a raw index (from getIndex) to the given palette index (NOT tile)
+    void setIndexCell(rcmapindex index, uint8_t pindex)
+    {
+        uint8_t shift = (index & SUBINDEXMASK) * Bits;
+        uint8_t * cell = this->map + (index >> INDEXSHIFT);
+        *cell = (*cell & ~(CELLMASK << shift)) | ((pindex & CELLMASK) << shift);
+        this->changed = true;
+    }
+
+    // Set the cell to the given palette index (NOT tile)
+    inline void setCellIndex(uint8_t x, uint8_t y, uint8_t pindex)
+    {
+        this->setIndexCell(this->getIndex(x, y), pindex);
+    }
+
+    // Find the palette index for the given tile. Returns PALETTESIZE if the tile isn't in the palette
+    uint8_t findPaletteIndex(uint8_t tile)
+    {
+        for(uint8_t i = 0; i < PALETTESIZE; i++)
+            if(this->palette[i] == tile)
+                return i;
+        return PALETTESIZE;
+    }
+
+    // Set the cell to the given tile. The tile must already be in the palette, otherwise the cell 
+    // is left alone and false is returned
+    bool setCell(uint8_t x, uint8_t y, uint8_t tile)
+    {
+        uint8_t pindex = this->findPaletteIndex(tile);
+        if(pindex == PALETTESIZE)
+            return false;
+        this->setCellIndex(x, y, pindex);
+        return true;
+    }
+
+    // Fill map with all of the given tile. The tile must be in the palette, otherwise the map is 
+    // left alone and false is returned
+    bool fillMap(uint8_t tile)
+    {
+        uint8_t pindex = this->findPaletteIndex(tile);
+        if(pindex == PALETTESIZE)
+            return false;
+        // Repeat the index across the whole byte
+        uint8_t fill = pindex;
+        for(uint8_t i = Bits; i < 8; i <<= 1)
+            fill |= fill << i;
+        uint16_t cells = this->width * this->height;
+        memset(this->map, fill, size_t(cells >> INDEXSHIFT));
+        // The last byte may only be partly used, don't touch past the end of the map
+        for(uint16_t i = cells & ~SUBINDEXMASK; i < cells; i++)
+            this->setIndexCell(i, pindex);
+        this->changed = true;
+        return true;
+    }
+
+    inline void markChanged()
+    {
+        this->changed = true;
+    }
+
+    // Draw the given maze starting at the given screen x + y
+    void drawMap(Arduboy2Base * arduboy, uint8_t x, uint8_t y)
+    {
+        for(uint8_t i = 0; i < this->height; ++i)
+            for(uint8_t j = 0; j < this->width; ++j)
+                arduboy->drawPixel(x + j, y + i, this->getCell(j, this->height - i - 1) ? WHITE : BLACK);
+    }
+
+    inline rcmapindex getIndex(uint8_t x, uint8_t y)
+    {
+        return (rcmapindex)y * this->width + x;
+    }
+
+    inline uint8_t getTile(rcmapindex index)
+    {
+        uint8_t cell = this->map[index >> INDEXSHIFT];
+        if(Bits == 4)
+        {
+            // Compiles to a nibble swap rather than a 4 bit shift loop
+            if(index & 1) cell >>= 4;
+        }
+        else
+        {
+            cell >>= (index & SUBINDEXMASK) << 1;
+        }
+        return this->palette[cell & CELLMASK];
+    }
+
+    inline uint8_t getCell(uint8_t x, uint8_t y)
+    {
+        return this->getTile(this->getIndex(x, y));
+    }
+};
+
+// A read-only raycast map rendered straight out of program memory, so the map itself takes no RAM.
+// OverlayCells is how many cells may differ from the progmem data at once (doors, switches, etc);
+// those are kept in a small RAM list which is checked before reading progmem. Each overlay cell 
+// costs 2-3 bytes, and every tile read during raycasting scans the list, so keep it small: in 
+// extras/bench/bench_maps (host) a full overlay of 4 made wall raycasting about 8% slower than 
+// RcMap, and 8 about 25% (without an overlay it's the same as RcMap)
+template<uint8_t OverlayCells = 0>
+class RcProgmemMap
+{
+public:
+    const uint8_t * map = NULL;
+    uint8_t width = 0;
+    uint8_t height = 0;
+    bool changed = true;
+    uint8_t overlayCount = 0;
+    rcmapindex overlayIndex[OverlayCells ? OverlayCells : 1];
+    uint8_t overlayTile[OverlayCells ? OverlayCells : 1];
+
+    // Switch to the given progmem map (row by row, one byte per tile), dropping any overlay cells
+    void load(const uint8_t * map, uint8_t width, uint8_t height)
+    {
+        this->map = map;
+        this->width = width;
+        this->height = height;
+        this->clearOverlay();
+    }
+
+    // Put every cell back to what's in progmem
+    void clearOverlay()
+    {
+        this->overlayCount = 0;
+        this->changed = true;
+    }
+
+    // Set the cell in the overlay. Setting a cell back to its progmem tile frees its overlay slot. 
+    // Returns false (and leaves the cell alone) if the overlay is full
+    bool setCell(uint8_t x, uint8_t y, uint8_t tile)
+    {
+        rcmapindex index = this->getIndex(x, y);
+        uint8_t i = 0;
+        while(i < this->overlayCount && this->overlayIndex[i] != index)
+            i++;
+
+        if(tile == pgm_read_byte(this->map + index))
+        {
+            // Swap the last one into the freed slot
+            if(i < this->overlayCount)
+            {
+                this->overlayCount--;
+                this->overlayIndex[i] = this->overlayIndex[this->overlayCount];
+                this->overlayTile[i] = this->overlayTile[this->overlayCount];
+            }
+        }
+        else
+        {
+            if(i == this->overlayCount)
+            {
+                if(i == OverlayCells)
+                    return false;
+                this->overlayIndex[i] = index;
+                this->overlayCount++;
+            }
+            this->overlayTile[i] = tile;
+        }
+
+        this->changed = true;
+        return true;
+    }
+
+    inline void markChanged()
+    {
+        this->changed = true;
+    }
+
+    // Draw the given maze starting at the given screen x + y
+    void drawMap(Arduboy2Base * arduboy, uint8_t x, uint8_t y)
+    {
+        for(uint8_t i = 0; i < this->height; ++i)
+            for(uint8_t j = 0; j < this->width; ++j)
+                arduboy->drawPixel(x + j, y + i, this->getCell(j, this->height - i - 1) ? WHITE : BLACK);
+    }
+
+    inline rcmapindex getIndex(uint8_t x, uint8_t y)
+    {
+        return (rcmapindex)y * this->width + x;
+    }
+
+    inline uint8_t getTile(rcmapindex index)
+    {
+        for(uint8_t i = 0; i < this->overlayCount; i++)
+            if(this->overlayIndex[i] == index)
+                return this->overlayTile[i];
+        return pgm_read_byte(this->map + index);
+    }
+
+    inline uint8_t getCell(uint8_t x, uint8_t y)
+    {
+        return this->getTile(this->getIndex(x, y));
+    }
+};
+
+// The RAM a container (RcContainer) reserves for its map, as a base class so map types which 
+// don't need any (RcProgmemMap) cost nothing. Only RcMap gets a buffer (mapBuffer), which is 
+// attached as a full RCMAXMAPDIMENSION square map; any other map type must be set up by you
+template<typename MapType>
+struct RcMapBuffer
+{
+    inline void attachMap(MapType * map) { }
+};
+
+template<>
+struct RcMapBuffer<RcMap>
+{
+    uint8_t mapBuffer[RCMAXMAPDIMENSION * RCMAXMAPDIMENSION];
+
+    inline void attachMap(RcMap * map)
+    {
+        map->map = this->mapBuffer;
+        map->width = RCMAXMAPDIMENSION;
+        map->height = RCMAXMAPDIMENSION;
+    }
+};
+
+// Read bytes sequentially out of program memory. Used for decoding maps
+struct RcProgmemReader
+{
+    const uint8_t * data;
+
+    inline uint8_t next()
+    {
+        return pgm_read_byte(this->data++);
+    }
+};
+
+// Decode a run-length encoded map into the given map (any map type), one row at a time. The 
+// format is a list of (run length, tile) byte pairs covering the map left to right, top to bottom;
+// runs are allowed to continue onto the next row. Tiles are written with setCell, so for a 
+// packed map they must already be in the palette. Reader must have a next() which returns the 
+// next byte, see RcProgmemReader (or RcFxReader if using the FX renderer).
+// Returns false if the data is bad, which is a run of length 0 or a tile the map refuses (not 
+// in a packed map's palette, RcProgmemMap overlay full). Decoding stops there, so the map is 
+// only partly loaded
+template<typename MapType, typename Reader>
+bool decodeRleMap(MapType * map, Reader * reader)
+{
+    uint8_t run = 0;
+    uint8_t tile = 0;
+
+    for(uint8_t y = 0; y < map->height; y++)
+    {
+        for(uint8_t x = 0; x < map->width; x++)
+        {
+            if(run == 0)
+            {
+                run = reader->next();
+                tile = reader->next();
+                if(run == 0)
+                    return false;
+            }
+            if(!map->setCell(x, y, tile))
+                return false;
+            run--;
+        }
+    }
+
+    return true;
+}
+
+// Decode a run-length encoded map out of program memory, see decodeRleMap for the format. 
+// Returns false if the data is bad
+template<typename MapType>
+inline bool loadRleMap(MapType * map, const uint8_t * rle)
+{
+    RcProgmemReader reader { rle };
+    return decodeRleMap(map, &reader);
+}
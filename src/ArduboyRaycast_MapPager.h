@@ -0,0 +1,184 @@
+#pragma once
+
+#include <Arduboy2.h>
+#include <FixedPoints.h>
+
+#include "ArduboyRaycast_Utils.h"
+#include "ArduboyRaycast_Map.h"
+#include "ArduboyRaycast_Player.h"
+#include "ArduboyRaycast_SpriteGroup.h"
+
+// A world map stored in program memory as one byte per tile, row by row. Used with RcMapPager
+struct RcProgmemMapSource
+{
+    const uint8_t * data;
+    uint16_t width;
+
+    inline void read(uint16_t x, uint16_t y, uint8_t * dest, uint8_t length)
+    {
+        memcpy_P(dest, this->data + (uint16_t)(y * this->width + x), length);
+    }
+};
+
+// Keeps a small window of a much larger world resident in an RcMap, so worlds can be far larger
+// than RAM (or the 8 bit map indices) would otherwise allow. The raycaster only ever sees the
+// window; whenever the player gets within 'margin' tiles of the window edge, the window is
+// recentered on the player, reloaded from the source, and the player is moved by the same amount
+// so nothing visibly changes.
+// - The window is the RcMap you pass in, so its buffer sets the window size. 16x16 works without
+//   any flags, 32x32 requires RCLARGEMAP.
+// - Sprites and bounds use muflot positions, which can't go past 16. If you use sprites, keep the
+//   window at 16x16. Sprites and bounds which leave the window when it moves are deleted, so the
+//   game must respawn them from its own world data (use originX/originY to know where you are)
+// - Source must have read(x, y, dest, length), which copies 'length' tiles from the world at x,y.
+//   See RcProgmemMapSource (or RcFxMapSource if using the FX renderer)
+// - The margin must cover every tile the raycaster can read, or rays run off the window (the 8 bit
+//   map index wraps onto the wrong tiles, and under RCLARGEMAP it reads past the buffer). That 
+//   depends on the view distance, so call setViewDistance with the renderer's _viewdistance 
+//   whenever you change the light intensity. Brighter = further = bigger margin: a 16x16 window 
+//   works up to a light intensity of about 1.1, a 32x32 one up to about 6
+template<typename Source>
+class RcMapPager
+{
+public:
+    Source source;
+    RcMap * window;
+    uint16_t worldWidth;
+    uint16_t worldHeight;
+    uint8_t margin = 7;     // marginFor(4.0), the default view distance. Set with setViewDistance
+
+    // The world tile the window's 0,0 is on
+    uint16_t originX = 0;
+    uint16_t originY = 0;
+
+    // How far the window moved last time it paged. Anything you track in window coordinates
+    // needs to have this subtracted
+    int16_t shiftX = 0;
+    int16_t shiftY = 0;
+
+    RcMapPager(Source source, RcMap * window, uint16_t worldWidth, uint16_t worldHeight) :
+        source(source), window(window), worldWidth(worldWidth), worldHeight(worldHeight) { }
+
+    // The margin needed for the given view distance (with a unit length player direction, which is
+    // the usual). The DDA stops at the view distance along the view direction, but rays at the 
+    // screen edges go up to sqrt(2) times further than that, and it reads one more tile past there
+    static uint8_t marginFor(uflot viewdistance)
+    {
+        return (uint8_t)ceil(1.4143f * (float)viewdistance) + 1;
+    }
+
+    // Set the margin for the given view distance (the renderer's _viewdistance). Returns false, 
+    // leaving the margin alone, if the window is too small for that view distance
+    bool setViewDistance(uflot viewdistance)
+    {
+        uint8_t margin = marginFor(viewdistance);
+        if(2 * margin >= this->window->width || 2 * margin >= this->window->height)
+            return false;
+        this->margin = margin;
+        return true;
+    }
+
+    // Reload the entire window from the source
+    void load()
+    {
+        for(uint8_t y = 0; y < this->window->height; y++)
+            this->source.read(this->originX, this->originY + y, this->window->map + this->window->getIndex(0, y), this->window->width);
+        this->window->markChanged();
+    }
+
+    // Move the window so its 0,0 is at the given world tile (clamped to the world) and reload it.
+    // Does NOT move the player; returns whether the window moved
+    bool moveTo(int16_t x, int16_t y)
+    {
+        x = max(0, min(x, (int16_t)(this->worldWidth - this->window->width)));
+        y = max(0, min(y, (int16_t)(this->worldHeight - this->window->height)));
+
+        this->shiftX = x - (int16_t)this->originX;
+        this->shiftY = y - (int16_t)this->originY;
+
+        if(this->shiftX == 0 && this->shiftY == 0)
+            return false;
+
+        this->originX = x;
+        this->originY = y;
+        this->load();
+        return true;
+    }
+
+    // Load the window around the given world position and put the player there. Use this for the
+    // initial load and for teleports
+    void placePlayer(RcPlayer * p, uint16_t worldX, uint16_t worldY)
+    {
+        if(!this->moveTo((int16_t)worldX - (this->window->width >> 1), (int16_t)worldY - (this->window->height >> 1)))
+            this->load(); // Still load, in case this is the first time
+        p->posX = uflot::fromInternal(((worldX - this->originX) << 8) | 0x80);
+        p->posY = uflot::fromInternal(((worldY - this->originY) << 8) | 0x80);
+    }
+
+    // Call after moving the player. If the player got close to the window edge, the window is
+    // recentered and the player shifted to match. Returns whether the window moved
+    bool update(RcPlayer * p)
+    {
+        uint8_t px = p->posX.getInteger();
+        uint8_t py = p->posY.getInteger();
+        uint8_t margin = this->margin;
+
+        if(px >= margin && py >= margin && px < this->window->width - margin && py < this->window->height - margin)
+            return false;
+
+        // The window might not move if the player is at the edge of the world
+        if(!this->moveTo((int16_t)this->originX + px - (this->window->width >> 1), (int16_t)this->originY + py - (this->window->height >> 1)))
+            return false;
+
+        p->posX = uflot::fromInternal(p->posX.getInternal() - (this->shiftX << 8));
+        p->posY = uflot::fromInternal(p->posY.getInternal() - (this->shiftY << 8));
+        return true;
+    }
+
+    // Same as above, but also shifts sprites and bounds, deleting any that leave the window
+    template<uint8_t InternalStateBytes>
+    bool update(RcPlayer * p, RcSpriteGroup<InternalStateBytes> * sprites)
+    {
+        if(!this->update(p))
+            return false;
+
+        int16_t sx = this->shiftX << 4;
+        int16_t sy = this->shiftY << 4;
+
+        for(uint8_t i = 0; i < sprites->numsprites; i++)
+        {
+            RcSprite<InternalStateBytes> * sprite = sprites->sprites + i;
+            if(!sprite->isActive())
+                continue;
+            if(!shiftCoord(&sprite->x, sx) || !shiftCoord(&sprite->y, sy))
+                sprites->deleteSprite(sprite);
+        }
+
+        for(uint8_t i = 0; i < sprites->numbounds; i++)
+        {
+            RcBounds * bounds = sprites->bounds + i;
+            if(!bounds->isActive())
+                continue;
+            if(!shiftCoord(&bounds->x1, sx) || !shiftCoord(&bounds->x2, sx) || !shiftCoord(&bounds->y1, sy) || !shiftCoord(&bounds->y2, sy))
+                sprites->deleteBounds(bounds);
+        }
+
+        sprites->reindexBounds();
+        return true;
+    }
+
+    // Convert a window tile to a world tile
+    inline uint16_t worldX(uint8_t x) { return this->originX + x; }
+    inline uint16_t worldY(uint8_t y) { return this->originY + y; }
+
+private:
+    // Shift a sprite coordinate by the given internal amount. Returns false if it went out of range
+    static bool shiftCoord(muflot * coord, int16_t shift)
+    {
+        int16_t result = (int16_t)coord->getInternal() - shift;
+        if(result < 0 || result > 0xFF)
+            return false;
+        *coord = muflot::fromInternal(result);
+        return true;
+    }
+};
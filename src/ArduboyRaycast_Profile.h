@@ -0,0 +1,157 @@
+#pragma once
+
+#include <Arduboy2.h>
+
+// Available flags for compilation
+// #define RCRENDERSTATS          // Count DDA steps, wall pixels and sprite stripes per frame into render.stats
+// #define RCPROFILE              // Time each rendering phase with micros() into render.profiler
+// #define RCPROFILEFRAMES 16     // How many frames of history the profiler keeps (RAM is 12 bytes per frame)
+
+// Wrap any statistics-only code in this so it disappears entirely when stats are off
+#ifdef RCRENDERSTATS
+#define RCSTAT(code) code
+#else
+#define RCSTAT(code)
+#endif
+
+// Start a phase timer in the current scope, then "mark" it at the end of each phase. Marking
+// charges the time since the last mark to the given phase and restarts the timer, so
+// interleaved phases (like sprite projection and drawing, which alternate per sprite) can share 
+// one timer. Don't mark inside per column loops: micros() costs about as much as a DDA step
+#ifdef RCPROFILE
+#define RCPROFILESTART(t) unsigned long t = micros();
+#define RCPROFILEMARK(t, phase) { unsigned long _rcnow = micros(); this->profiler.add(phase, _rcnow - t); t = _rcnow; }
+#else
+#define RCPROFILESTART(t)
+#define RCPROFILEMARK(t, phase)
+#endif
+
+#ifndef RCPROFILEFRAMES
+#define RCPROFILEFRAMES 16
+#endif
+
+enum RcProfilePhase : uint8_t
+{
+    Background,
+    Walls,
+    SpriteSort,
+    SpriteProject,
+    SpriteDraw,
+    Floor,
+    RcProfilePhaseCount
+};
+
+constexpr char RCPROFILENAMES[RcProfilePhaseCount][5] PROGMEM = {
+    "bg", "wall", "sort", "proj", "sprt", "flor"
+};
+
+// Work counters for a single frame of raycasting. These are meant for benchmarking (on
+// the host or in a simulator), so they count work done rather than time taken. Everything
+// is reset at the start of raycastWalls, so read them after drawSprites.
+template<uint8_t W>
+struct RcRenderStats
+{
+    uint8_t columnSteps[W];     // DDA steps taken per column
+    uint16_t ddaSteps;          // DDA steps taken for the whole frame
+    uint8_t maxColumnSteps;     // The worst column
+    uint8_t wallColumns;        // Columns which actually drew a wall
+    uint8_t lodColumns;         // Columns drawn as a flat fill instead (RCWALLLOD)
+    uint8_t linesReused;        // Wall columns that reused the last column's projection (same distance)
+    uint8_t stripsReused;       // Wall columns that reused the last column's texture strip
+    uint16_t wallPixels;        // Total wall pixels written (not bytes)
+    uint8_t spritesDrawn;       // Sprites which made it past projection
+    uint16_t spriteStripes;     // Sprite stripes that passed the depth test and were drawn
+    uint16_t spritePixels;      // Total sprite pixels processed (masked or not)
+    uint16_t floorPixels;       // Floor + ceiling pixels cast (RCFLOORCASTING)
+    uint16_t frames;            // Number of frames counted since startup
+
+    void reset()
+    {
+        uint16_t frames = this->frames;
+        memset(this, 0, sizeof(RcRenderStats<W>));
+        this->frames = frames + 1;
+    }
+
+    inline void recordColumn(uint8_t x, uint8_t steps)
+    {
+        this->columnSteps[x] = steps;
+        this->ddaSteps += steps;
+        if(steps > this->maxColumnSteps)
+            this->maxColumnSteps = steps;
+    }
+};
+
+// Rolling per-phase frame timings. Time is accumulated into the current frame with add(), then
+// committed to a small ring buffer with endFrame() (RcContainer::runIteration does this for you).
+// All values are in microseconds; note that micros() only has 4us resolution and costs a few
+// microseconds itself. Walls (DDA + drawing) are timed once per frame as a whole, since splitting
+// them would mean timing every column; RCRENDERSTATS' ddaSteps + wallPixels show the split.
+class RcProfiler
+{
+public:
+    uint16_t current[RcProfilePhaseCount];
+    uint16_t history[RcProfilePhaseCount][RCPROFILEFRAMES];
+    uint8_t head = 0;
+    uint8_t count = 0;
+
+    inline void add(RcProfilePhase phase, uint16_t us)
+    {
+        this->current[phase] += us;
+    }
+
+    // Commit the current frame into the history and start a new one
+    void endFrame()
+    {
+        for(uint8_t i = 0; i < RcProfilePhaseCount; i++)
+        {
+            this->history[i][this->head] = this->current[i];
+            this->current[i] = 0;
+        }
+
+        if(++this->head >= RCPROFILEFRAMES)
+            this->head = 0;
+        if(this->count < RCPROFILEFRAMES)
+            this->count++;
+    }
+
+    uint16_t getMin(RcProfilePhase phase)
+    {
+        uint16_t result = 0xFFFF;
+        for(uint8_t i = 0; i < this->count; i++)
+            result = min(result, this->history[phase][i]);
+        return this->count ? result : 0;
+    }
+
+    uint16_t getMax(RcProfilePhase phase)
+    {
+        uint16_t result = 0;
+        for(uint8_t i = 0; i < this->count; i++)
+            result = max(result, this->history[phase][i]);
+        return result;
+    }
+
+    uint16_t getAverage(RcProfilePhase phase)
+    {
+        uint32_t total = 0;
+        for(uint8_t i = 0; i < this->count; i++)
+            total += this->history[phase][i];
+        return this->count ? total / this->count : 0;
+    }
+
+    // Dump min/avg/max for every phase, one line each. Pass &Serial, or anything else that
+    // implements Print (such as a host shim)
+    void print(Print * out)
+    {
+        for(uint8_t i = 0; i < RcProfilePhaseCount; i++)
+        {
+            RcProfilePhase phase = (RcProfilePhase)i;
+            out->print((const __FlashStringHelper *)RCPROFILENAMES[i]);
+            out->print(' ');
+            out->print(this->getMin(phase));
+            out->print(' ');
+            out->print(this->getAverage(phase));
+            out->print(' ');
+            out->println(this->getMax(phase));
+        }
+    }
+};
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <FixedPoints.h>
+
+#include "ArduboyRaycast_Utils.h"
+
+// Per-column ray directions and DDA step lengths for a given player direction. None of this
+// depends on the player position, so it only needs rebuilding when the player turns. Costs
+// 8 bytes of RAM per column (1kb for a full 128 wide view!), so this is only enabled with
+// RCCACHERAYS and only really practical for narrow views or games with RAM to spare
+template<uint8_t W>
+class RcRayCache
+{
+public:
+    static constexpr flot INVWIDTH2 = 2.0f / W;
+
+    flot rayDirX[W];
+    flot rayDirY[W];
+    uflot deltaDistX[W];    // Already reciprocal. 0 means never step in this direction
+    uflot deltaDistY[W];
+
+    // The direction the table was built for. 0,0 is never a valid direction
+    float dirX = 0;
+    float dirY = 0;
+
+    // Rebuild the table if the direction changed since last time. Returns whether it was rebuilt
+    bool update(float dirX, float dirY)
+    {
+        if(dirX == this->dirX && dirY == this->dirY)
+            return false;
+
+        this->dirX = dirX;
+        this->dirY = dirY;
+
+        flot dX = dirX, dY = dirY;
+
+        for (uint8_t x = 0; x < W; x++)
+        {
+            // Exactly the same math raycastWalls does when the cache is off
+            flot cameraX = x * INVWIDTH2 - 1;
+            flot rdX = dX + dY * cameraX;
+            flot rdY = dY - dX * cameraX;
+            uflot ddX = (uflot)abs(rdX);
+            uflot ddY = (uflot)abs(rdY);
+
+            this->rayDirX[x] = rdX;
+            this->rayDirY[x] = rdY;
+            this->deltaDistX[x] = 0;
+            this->deltaDistY[x] = 0;
+            if(ddX > NEARZEROFIXED) this->deltaDistX[x] = uReciprocalNearUnit(ddX);
+            if(ddY > NEARZEROFIXED) this->deltaDistY[x] = uReciprocalNearUnit(ddY);
+        }
+
+        return true;
+    }
+};
@@ -1,768 +1,1589 @@
-#pragma once
-
-#include <FixedPoints.h>
-#include <Arduboy2.h>
-
-#include "ArduboyRaycast_Utils.h"
-#include "ArduboyRaycast_Map.h"
-#include "ArduboyRaycast_Player.h"
-#include "ArduboyRaycast_SpriteGroup.h"
-#include "ArduboyRaycast_Shading.h"
-
-// Available flags for compilation
-// #define RCSMALLLOOPS           // The raycaster makes use of loop unrolling, which adds about 1.5kb code. This removes that but performance severely drops
-
-// Debug flags 
-// #define RCGENERALDEBUG       // Must be set for any of the othere to work
-// #define RCLINEHEIGHTDEBUG      // Display information about lineheight (only draws a few lines)
-// #define RCPRINTSPRITEDATA      // Display information about certain sprite-related properties
-
-#ifdef RCGENERALDEBUG
-#include <Tinyfont.h>
-#endif
-
-// -------------- CALCULATED / ASSUMED CONSTANTS, TRY NOT TO TOUCH ------------------------
-constexpr uint8_t BWIDTH = WIDTH >> 3;
-// Some assumptions (please try to follow these instead of changing them)
-constexpr uint8_t RCEMPTY = 0;
-constexpr uint8_t RCTILESIZE = 16;
-// ------------------------------------------------------------------------------
-
-
-// A container for precalculated sprite information. These are calculations we
-// don't want to do per-frame
-struct RcSpriteDrawPrecalc
-{
-    float fposX;
-    float fposY;
-    float invDet;
-};
-
-// A container for calculated sprite draw data. You know a calculation was not performed
-// if stepX and stepY are 0
-struct RcSpriteDrawData
-{
-    uint8_t drawStartX;
-    uint8_t drawStartY;
-    uint8_t drawEndY;
-    uint8_t drawEndX;
-
-    uflot texXInit;
-    uflot texYInit;
-    uflot stepX = 0;
-    uflot stepY = 0;
-
-    uflot transformY;
-};
-
-enum RcShadingType : uint8_t
-{
-    None,
-    Black,
-    White
-};
-
-struct RcShadeInfo
-{
-    uint8_t shading;
-    RcShadingType type;
-};
-
-#define RCMASKTOP(shading, shade, yofs) \
-    if(shading.type == RcShadingType::White) shade &= pgm_read_byte(shade_mask + yofs); \
-    else shade |= ~pgm_read_byte(shade_mask + yofs);
-#define RCMASKBOTTOM(shading, shade, yofs) \
-    if(shading.type == RcShadingType::White) shade &= ~pgm_read_byte(shade_mask + yofs); \
-    else shade |= pgm_read_byte(shade_mask + yofs);
-
-// Raycast renderer container, tracks data used for raycasting + lets you render raycasting
-template<uint8_t W, uint8_t H>
-class RcRender
-{
-public:
-    static constexpr uint8_t VIEWWIDTH = W;
-    static constexpr uint8_t VIEWHEIGHT = H;
-    static constexpr uint8_t VIEWHEIGHTBYTES = VIEWHEIGHT >> 3;
-    static constexpr uint8_t MIDSCREENY = VIEWHEIGHT / 2;
-    static constexpr uint8_t MIDSCREENX = VIEWWIDTH / 2;
-    static constexpr uflot INVWIDTH = 1.0 / VIEWWIDTH;
-    static constexpr float INVHEIGHT = 1.0 / VIEWHEIGHT;
-    static constexpr flot INVWIDTH2 = 2.0f / VIEWWIDTH;
-    static constexpr uint16_t MAXLHEIGHT = 32768;
-    static constexpr float MINLDISTANCE = 1.0f / MAXLHEIGHT;
-    static constexpr float MINSPRITEDISTANCE = 0.2;
-    static constexpr uflot SPRITEVIEWEXENTSION = 1;
-
-    uflot lightintensity = 1.0;     // Impacts view distance + shading even when no shading applied
-    const uint8_t * tilesheet = NULL;
-    const uint8_t * spritesheet = NULL;
-    const uint8_t * spritesheet_mask = NULL;
-    muflot spritescaling[4] = { 1.5, 1.0, 0.5, 0.25 };
-
-    uint8_t cornershading = 1;
-    RcShadingType shading = RcShadingType::Black;
-    RcShadingType altWallShading = RcShadingType::Black;
-    RcShadingType spriteShading = RcShadingType::None; //Sprite shading is kinda weird
-
-    // I want these to be private but they're needed elsewhere
-    uflot _viewdistance = 4.0;      // Calculated value
-    uflot _darkness = 1.0;          // Calculated value
-    uflot _distCache[VIEWWIDTH / 2]; // Half distance resolution means sprites will clip 1 pixel into walls sometimes but otherwise...
-
-    #ifdef RCGENERALDEBUG
-    Tinyfont * tinyfont;
-    #endif
-
-    // Clear the area represented by this raycaster
-    inline void clearRaycast(Arduboy2Base * arduboy)
-    {
-        fastClear(arduboy, 0, 0, VIEWWIDTH, VIEWHEIGHT);
-    }
-
-    // Draw a fast(?) raycast background, assumed to start at 0,0. Your background should
-    // NOT have the usual width/height. Will underdraw in the Y direction if VIEWHEIGHT not 
-    // a multiple of 8
-    inline void drawRaycastBackground(Arduboy2Base * arduboy, const uint8_t * bg)
-    {
-        for(uint8_t i = 0; i < VIEWHEIGHTBYTES; ++i)
-            memcpy_P(arduboy->sBuffer + i * WIDTH, bg + i * VIEWWIDTH, VIEWWIDTH);
-    }
-
-    // Calculate the appropriate shading for this wall slice given our rendering config
-    inline RcShadeInfo calculateShading(uflot distance, uint8_t x, RcShadingType shading)
-    {
-        if(shading == RcShadingType::None)
-        {
-            return RcShadeInfo {
-                0xFF,
-                RcShadingType::Black
-            };
-        }
-        else
-        {
-            RcShadeInfo result {
-                calcShading(distance, x, this->_darkness),
-                shading
-            };
-            if(shading == RcShadingType::White)
-                result.shading = ~result.shading;
-            return result;
-        }
-    }
-
-    // Set the light intensity for raycasting. Performs several expensive calculations, only set this
-    // when necessary
-    void setLightIntensity(uflot intensity)
-    {
-        // Skip complicated calcs
-        if(intensity == this->lightintensity)
-            return;
-
-        this->lightintensity = intensity;
-        this->_viewdistance = sqrt(BAYERGRADIENTS * (float)intensity);
-        this->_darkness = 1 / intensity;
-    }
-
-    // The full function for raycasting. 
-    void raycastWalls(RcPlayer * p, RcMap * map, Arduboy2Base * arduboy)
-    {
-        uint8_t pmapX = p->posX.getInteger();
-        uint8_t pmapY = p->posY.getInteger();
-        uint8_t startMapIndex = map->getIndex(pmapX, pmapY);
-        uflot pmapofsX = p->posX - pmapX;
-        uflot pmapofsY = p->posY - pmapY;
-        flot fposX = (flot)p->posX, fposY = (flot)p->posY;
-        flot dX = p->dirX, dY = p->dirY;
-        const uint8_t * tilesheet = this->tilesheet;
-        uflot viewdistance = this->_viewdistance;
-        uflot * distCache = this->_distCache;
-
-        //RcShadeInfo shade;
-        uint8_t texX = 0;
-        uint16_t texData = 0;
-
-        for (uint8_t x = 0; x < VIEWWIDTH; x++)
-        {
-            flot cameraX = x * INVWIDTH2 - 1; // x-coordinate in camera space
-
-            // The camera plane is a simple -90 degree rotation on the player direction (as required for this algorithm).
-            flot rayDirX = dX + dY * cameraX;
-            flot rayDirY = dY - dX * cameraX;
-
-            // length of ray from one x or y-side to next x or y-side. But we prefill it with
-            // some initial data which has to be massaged later.
-            uflot deltaDistX = (uflot)abs(rayDirX); //Temp value; may not be used
-            uflot deltaDistY = (uflot)abs(rayDirY); //same
-
-            // length of ray from current position to next x or y-side
-            uflot sideDistX = MAXFIXED;
-            uflot sideDistY = MAXFIXED;
-
-            // what direction to step in x or y-direction (either +1 or -1)
-            int8_t stepX = 0;
-            int8_t stepY = 0;
-
-            // With this DDA stepping algorithm, have to be careful about making too-large values
-            // with our tiny fixed point numbers. Make some arbitrarily small cutoff point for
-            // even trying to deal with steps in that direction. As long as the map size is 
-            // never larger than 1 / NEARZEROFIXED on any side, it will be fine (that means
-            // map has to be < 100 on a side with this)
-            if(deltaDistX > NEARZEROFIXED) {
-                deltaDistX = uReciprocalNearUnit(deltaDistX); 
-                if (rayDirX < 0) {
-                    stepX = -1;
-                    sideDistX = pmapofsX * deltaDistX;
-                }
-                else {
-                    stepX = 1;
-                    sideDistX = (1 - pmapofsX) * deltaDistX;
-                }
-            }
-            if(deltaDistY > NEARZEROFIXED) {
-                deltaDistY = uReciprocalNearUnit(deltaDistY); 
-                if (rayDirY < 0) {
-                    stepY = -map->width;
-                    sideDistY = pmapofsY * deltaDistY;
-                }
-                else {
-                    stepY = map->width;
-                    sideDistY = (1 - pmapofsY) * deltaDistY;
-                }
-            }
-
-            uint8_t side;           // was a NS or a EW wall hit?
-            uint8_t mapIndex = startMapIndex;
-            uflot perpWallDist = 0;   // perpendicular distance (not real distance)
-            uint8_t tile;
-
-            // perform DDA. A do/while loop is ever-so-slightly faster it seems?
-            do
-            {
-                // jump to next map square, either in x-direction, or in y-direction
-                if (sideDistX < sideDistY) {
-                    perpWallDist = sideDistX; // Remember that sideDist is actual distance and not distance only in 1 direction
-                    sideDistX += deltaDistX;
-                    mapIndex += stepX;
-                    side = 0; //0 = xside hit
-                }
-                else {
-                    perpWallDist = sideDistY;
-                    sideDistY += deltaDistY;
-                    mapIndex += stepY;
-                    side = 1; //1 = yside hit
-                }
-                tile = map->map[mapIndex];
-            }
-            while (perpWallDist < viewdistance && tile == RCEMPTY);
-
-            //Only calc distance for every other point to save a lot of memory (100 bytes)
-            if((x & 1) == 0)
-                distCache[x >> 1] = perpWallDist;
-
-            // If the above loop was exited without finding a tile, there's nothing to draw
-            if(tile == RCEMPTY) continue;
-
-            //NOTE: wallX technically can only be positive, but I'm using flot to save a tiny amount from casting
-            flot wallX = side ? fposX + (flot)perpWallDist * rayDirX : fposY + (flot)perpWallDist * rayDirY;
-            wallX -= floorFixed(wallX); //.getFraction isn't working!
-            texX = uint8_t(wallX * RCTILESIZE);
-            if((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = RCTILESIZE - 1 - texX;
-
-            if((side & x) && this->altWallShading != RcShadingType::None)
-                texData = this->altWallShading == RcShadingType::Black ? 0x0000 : 0xFFFF;
-            else
-                texData = readTextureStrip16(tilesheet, tile, texX);
-
-            #ifdef RCLINEHEIGHTDEBUG
-            tinyfont.setCursor(16, x * 16);
-            tinyfont.println(lineHeight);
-            tinyfont.setCursor(16, x * 16 + 8);
-            tinyfont.println((float)perpWallDist);
-            if(x > 2) break;
-            #endif
-
-            //ending should be exclusive
-            drawWallLine(x, perpWallDist, this->calculateShading(perpWallDist, x, this->shading), texData, arduboy);
-        }
-    }
-
-    //Draw a single raycast wall line. Will only draw specifically the wall line and will clip out all the rest
-    //(so you can predraw a ceiling and floor before calling raycast)
-    void drawWallLine(uint8_t x, uflot distance, RcShadeInfo shading, uint16_t texData, Arduboy2Base * arduboy)
-    {
-        // ------- BEGIN CRITICAL SECTION -------------
-        float invLineHeight = INVHEIGHT * (float)distance; 
-        UFixed<16,16> step = RCTILESIZE * invLineHeight;
-
-        uint16_t lineHeight = (invLineHeight <= MINLDISTANCE) ? MAXLHEIGHT : (uint16_t)(1 / invLineHeight);
-
-        int16_t halfLine = lineHeight >> 1;
-        uint8_t yStart = max(0, MIDSCREENY - halfLine);
-        uint8_t yEnd = min(VIEWHEIGHT, MIDSCREENY + halfLine); //EXCLUSIVE
-
-        //Everyone prefers the high precision tiles (and for some reason, it's now faster? so confusing...)
-        UFixed<16,16> texPos = (yStart + halfLine - MIDSCREENY) * step;
-
-        //These four variables are needed as part of the loop unrolling system
-        uint16_t bofs;
-        uint8_t texByte;
-        uint8_t thisWallByte = yStart;
-        TOBYTECOUNT(thisWallByte);
-        uint8_t * sbuffer = arduboy->sBuffer;
-        uint8_t shade = shading.shading;
-
-        uint8_t fullstep = step.getInteger();
-        uint8_t accustep = (step.getFraction() >> 8);
-        uint8_t accum = (texPos.getFraction() >> 8);
-        texData >>= texPos.getInteger();
-
-        //Pull wall byte, save location
-        #define _WALLREADBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs];
-        //Write previously read wall byte, go to next byte
-        #define _WALLWRITENEXT(mixin) if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & shade) mixin; } else { sbuffer[bofs] = (texByte | shade) mixin;} thisWallByte++;
-        //Work for setting bits of wall byte. Use an imperfect overflow accumulator to approximate stepping through texture.
-        #define _WALLBITUNROLL(bm,nbm) \
-            if(texData & 1) texByte |= (bm); \
-            else texByte &= (nbm); \
-            asm volatile( \
-                "add %[accum], %[step]    \n" \
-                "brcc .+4       \n" \
-                "lsr %B[td]     \n" \
-                "ror %A[td]     \n" \
-                : [accum] "+&r" (accum), \
-                  [td] "+&r" (texData)    \
-                : [step] "r" (accustep) \
-            ); 
-        
-        // The above volatile section is a special fractional accumulator which uses the carry bit to determine
-        // if an additional right shift of the texture is in order
-
-        _WALLREADBYTE();
-
-        #ifndef RCSMALLLOOPS
-
-        uint8_t startByte = thisWallByte; //The byte within which we start, always inclusive
-        uint8_t endByte = yEnd;
-        TOBYTECOUNT(endByte);
-
-        uint8_t yofs = yStart & 7;
-
-        //First and last bytes are tricky
-        if(yofs)
-        {
-            uint8_t endFirst = min((startByte + 1) * 8, yEnd);
-            uint8_t bm = fastlshift8(yofs);
-
-            if(fullstep)
-            {
-                for (uint8_t i = yStart; i < endFirst; i++) {
-                    _WALLBITUNROLL(bm, (~bm));
-                    texData >>= fullstep;
-                    bm <<= 1;
-                }
-            }
-            else
-            {
-                for (uint8_t i = yStart; i < endFirst; i++) {
-                    _WALLBITUNROLL(bm, (~bm));
-                    bm <<= 1;
-                }
-            }
-
-            //Move to next, like it never happened (but mask shading)
-            RCMASKTOP(shading, shade, yofs);
-            _WALLWRITENEXT();
-            _WALLREADBYTE();
-            shade = shading.shading;
-        }
-
-        // Now the unrolled loop
-        if(fullstep)
-        {
-            while (thisWallByte < endByte)
-            {
-                _WALLBITUNROLL(0b00000001, 0b11111110);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b00000010, 0b11111101);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b00000100, 0b11111011);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b00001000, 0b11110111);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b00010000, 0b11101111);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b00100000, 0b11011111);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b01000000, 0b10111111);
-                    texData >>= fullstep;
-                _WALLBITUNROLL(0b10000000, 0b01111111);
-                    texData >>= fullstep;
-                _WALLWRITENEXT();
-                _WALLREADBYTE();
-            }
-        }
-        else
-        {
-            while (thisWallByte < endByte)
-            {
-                _WALLBITUNROLL(0b00000001, 0b11111110);
-                _WALLBITUNROLL(0b00000010, 0b11111101);
-                _WALLBITUNROLL(0b00000100, 0b11111011);
-                _WALLBITUNROLL(0b00001000, 0b11110111);
-                _WALLBITUNROLL(0b00010000, 0b11101111);
-                _WALLBITUNROLL(0b00100000, 0b11011111);
-                _WALLBITUNROLL(0b01000000, 0b10111111);
-                _WALLBITUNROLL(0b10000000, 0b01111111);
-                _WALLWRITENEXT();
-                _WALLREADBYTE();
-            }
-        }
-
-        yofs = yEnd & 7;
-        //Last byte, but only need to do it if we don't simply span one byte
-        if(yofs && startByte != endByte)
-        {
-            uint8_t bm = 1;
-            if(fullstep)
-            {
-                for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
-                    _WALLBITUNROLL(bm, (~bm));
-                    texData >>= fullstep;
-                    bm <<= 1;
-                }
-            }
-            else
-            {
-                for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
-                    _WALLBITUNROLL(bm, (~bm));
-                    bm <<= 1;
-                }
-            }
-
-            //"Don't repeat yourself": that ship has sailed. Anyway, only write the last byte if we need to, otherwise
-            //we could legitimately write outside the bounds of the screen.
-            RCMASKBOTTOM(shading, shade, yofs);
-            if(cornershading) { _WALLWRITENEXT(& ~(fastlshift8(yofs))); }
-            else { _WALLWRITENEXT(); }
-        }
-
-        #else // No loop unrolling
-
-        //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
-        if((yStart & 7) == 0) thisWallByte--;
-        uint8_t bm = fastlshift8(yStart & 7);
-
-        do
-        {
-            uint8_t bidx = yStart & 7;
-
-            // Every new byte, save the current (previous) byte and load the new byte from the screen. 
-            // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
-            if(bidx == 0) {
-                bm = 1;
-                _WALLWRITENEXT();
-                _WALLREADBYTE();
-            }
-
-            _WALLBITUNROLL(bm, ~bm);
-            if(fullstep) { texData >>= fullstep; }
-            bm <<= 1;
-        }
-        while(++yStart < yEnd);
-
-        if(cornershading && yEnd != VIEWHEIGHT) { _WALLWRITENEXT(& ~(fastlshift8(yEnd & 7))); }
-        else { _WALLWRITENEXT(); }
-
-        #endif
-
-        // ------- END CRITICAL SECTION -------------
-    }
-
-
-    //Precalculate some sprite drawing stuff, happens before any loop, not tied to a sprite
-    RcSpriteDrawPrecalc precalcSpriteDraw(RcPlayer * player)
-    {
-        RcSpriteDrawPrecalc result;
-
-        result.fposX = (float)player->posX;
-        result.fposY = (float)player->posY;
-        result.invDet = 1.0 / (player->dirY * player->dirY + player->dirX * player->dirX); // required for correct matrix multiplication
-
-        return result;
-    }
-
-    template<uint8_t InternalStateBytes>
-    RcSpriteDrawData calcSpriteDraw(RcSpriteDrawPrecalc * calc, RcPlayer * player, RcSprite<InternalStateBytes> * sprite)
-    {
-        RcSpriteDrawData result;
-
-        float spriteX = (float)sprite->x - calc->fposX;
-        float spriteY = (float)sprite->y - calc->fposY;
-
-        float transformYT = calc->invDet * (player->dirX * spriteX + player->dirY * spriteY); // this is actually the depth inside the screen, that what Z is in 3D
-
-        // Nice quick shortcut to get out for sprites behind us (and ones that are too close / far)
-        if (transformYT < MINSPRITEDISTANCE ) //|| transformYT > _viewdistance + SPRITEVIEWEXENTSION) //_sviewdistance)
-            return result;
-
-        float invTransformYT = 1 / transformYT;
-        float transformXT = calc->invDet * (player->dirY * spriteX - player->dirX * spriteY);
-
-        // int16 because easy overflow! if x is much larger than y, then you're effectively multiplying 50 by map width.
-        //  NOTE: this is the CENTER of the sprite, not the edge (thankfully)
-        int16_t spriteScreenX = int16_t(MIDSCREENX * (1 + transformXT * invTransformYT));
-
-        // calculate the dimensions of the sprite on screen. All sprites are square. Size mods go here
-        // using 'transformY' instead of the real distance prevents fisheye
-        float scale = (float)this->spritescaling[(sprite->state & RSSTATESIZE) >> 1];
-        uint16_t spriteHeight = uint16_t(VIEWHEIGHT * invTransformYT * scale);
-        uint16_t spriteWidth = spriteHeight;
-
-        // calculate lowest and highest pixel to fill. Sprite screen/start X and Sprite screen/start Y
-        // Because we have 1 fewer bit to store things, we unfortunately need an int16
-        int16_t ssX = -(spriteWidth >> 1) + spriteScreenX; // Offsets go here, but modified by distance or something?
-        int16_t ssXe = ssX + spriteWidth;                  // EXCLUSIVE
-
-        // Get out if sprite is completely outside view
-        if (ssXe < 0 || ssX > VIEWWIDTH)
-            return result;
-
-        // Calculate vertical shift from top 5 bits of state
-        uint8_t yShiftBits = sprite->state;
-        TOBYTECOUNT(yShiftBits); //((sprite->state >> 1) >> 1) >> 1;
-        int16_t yShift = yShiftBits ? int16_t((yShiftBits & 16 ? -(yShiftBits & 15) : (yShiftBits & 15)) * max(scale, 1.0) * 2.0 * invTransformYT) : 0;
-        // The above didn't work without float math, didn't feel like figuring out the ridiculous type casting
-
-        int16_t ssY = -(spriteHeight >> 1) + MIDSCREENY + yShift;
-        int16_t ssYe = ssY + spriteHeight; // EXCLUSIVE
-
-        if (ssYe < 0 || ssY > VIEWHEIGHT)
-            return result;
-
-        result.drawStartY = ssY < 0 ? 0 : ssY; // Because of these checks, we can store them in 1 byte stuctures
-        result.drawEndY = ssYe > VIEWHEIGHT ? VIEWHEIGHT : ssYe;
-        result.drawStartX = ssX < 0 ? 0 : ssX;
-        result.drawEndX = ssXe > VIEWWIDTH ? VIEWWIDTH : ssXe;
-
-        // Setup stepping to avoid costly mult (and div) in critical loops
-        // These float divisions happen just once per sprite, hopefully that's not too bad.
-        // There used to be an option to set the precision of sprites but it didn't seem to make any difference
-        float stepXf = (float)RCTILESIZE / spriteWidth;
-        float stepYf = (float)RCTILESIZE / spriteHeight;
-
-        result.texXInit = (result.drawStartX - ssX) * stepXf; // This unfortunately needs float because of precision glitches
-        result.texYInit = (result.drawStartY - ssY) * stepYf;
-        result.stepX = stepXf;
-        result.stepY = stepYf;
-        result.transformY = (uflot)transformYT;
-
-        #ifdef RCPRINTSPRITEDATA
-        //Clear a section for us to use
-        constexpr uint8_t sdh = 10;
-        arduboy->fillRect(0, HEIGHT - sdh, VIEWWIDTH, sdh, BLACK);
-        //Print some junk
-        tinyfont->setCursor(0, HEIGHT - sdh);
-        tinyfont->print((float)transformXT, 4);
-        tinyfont->print(" Y");
-        tinyfont->print(ssY);
-        tinyfont->setCursor(0, HEIGHT - sdh + 5);
-        tinyfont->print((float)transformYT, 4);
-        tinyfont->print(" W");
-        tinyfont->print(spriteWidth);
-        #endif
-
-        return result;
-    }
-
-
-    template<uint8_t InternalStateBytes>
-    void drawSprites(RcPlayer * player, RcSpriteGroup<InternalStateBytes> * group, Arduboy2Base * arduboy)
-    {
-        uint8_t usedSprites = group->sortSprites(player->posX, player->posY);
-
-        // Buffers, we pull them out like this just to make it a little easier (might remove later)
-        const uint8_t * spritesheet = this->spritesheet;
-        const uint8_t * spritesheet_Mask = this->spritesheet_mask;
-        uint8_t * sbuffer = arduboy->sBuffer;
-        uflot * distCache = this->_distCache;
-
-        RcSpriteDrawPrecalc precalc = precalcSpriteDraw(player);
-
-        // after sorting the sprites, do the projection and draw them. We know all sprites in the array are active,
-        // since we're looping against the sorted array.
-        for (uint8_t i = 0; i < usedSprites; i++)
-        {
-            //Get the current sprite so we don't have to dereference multiple pointers
-            RcSprite<InternalStateBytes> * sprite = group->sortedSprites[i].sprite;
-
-            RcSpriteDrawData drawData = calcSpriteDraw(&precalc, player, sprite);
-
-            // Skip drawing, it was determined nothing was needed
-            if(drawData.stepX == 0 && drawData.stepY == 0) continue;
-
-            uflot texX = drawData.texXInit;
-            uint8_t fr = sprite->frame;
-
-            uint8_t drawStartByte = drawData.drawStartY;
-            TOBYTECOUNT(drawStartByte); 
-            uint8_t drawEndByte = drawData.drawEndY;
-            TOBYTECOUNT(drawEndByte); 
-            uint16_t texData = 0;
-            uint16_t texMask = 0;
-
-            //uint8_t lastAccum;
-            uint8_t accumStart = drawData.texYInit.getFraction();
-            uint8_t accustep = drawData.stepY.getFraction();
-            uint8_t fullstep = drawData.stepY.getInteger();
-            uint8_t preshift = drawData.texYInit.getInteger();
-
-            uint8_t x = drawData.drawStartX;
-
-            // ------- BEGIN CRITICAL SECTION -------------
-            do //For every strip (x)
-            {
-                //If the sprite is hidden, skip this line. Lots of calculations bypassed!
-                if (drawData.transformY < distCache[x >> 1])
-                {
-                    uint8_t tx = texX.getInteger();
-
-                    texData = readTextureStrip16(spritesheet, fr, tx) >> preshift;
-                    texMask = readTextureStrip16(spritesheet_Mask, fr, tx) >> preshift;
-
-                    //A small optimization for small sprites
-                    if(!texMask) goto SKIPSPRITESTRIPE;
-
-                    RcShadeInfo shading = this->calculateShading(drawData.transformY, x, this->spriteShading);
-                    uint8_t shade = shading.shading;
-
-                    //These five variables (including texData+texMask) are needed as part of the loop unrolling system
-                    uint16_t bofs;
-                    uint8_t texByte;
-                    uint8_t maskByte;
-                    uint8_t thisWallByte = drawStartByte;
-
-                    uint8_t accum = accumStart;
-
-                    //Pull screen byte, save location
-                    #define _SPRITEREADSCRBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs]; maskByte = 0;
-                    //Write previously read screen byte, go to next byte
-                    #define _SPRITEWRITESCRNEXT() if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & (shade | ~maskByte)); } else { sbuffer[bofs] = (texByte | (shade & maskByte));} thisWallByte++;
-                    //Work for setting bits of screen byte
-                    #define _SPRITEBITUNROLL(bm,nbm) \
-                        if (texMask & 1) { if (texData & 1) texByte |= bm; else texByte &= nbm; maskByte |= bm; } \
-                        asm volatile( \
-                            "add %[accum], %[step]    \n" \
-                            "brcc .+8       \n" \
-                            "lsr %B[td]     \n" \
-                            "ror %A[td]     \n" \
-                            "lsr %B[td2]     \n" \
-                            "ror %A[td2]     \n" \
-                            : [accum] "+&r" (accum), \
-                              [td] "+&r" (texData),  \
-                              [td2] "+&r" (texMask)  \
-                            : [step] "r" (accustep) \
-                        ); \
-                        if(fullstep) { texMask >>= fullstep; texData >>= fullstep; }
-
-                    _SPRITEREADSCRBYTE();
-
-                    #ifndef RCSMALLLOOPS
-
-                    uint8_t yofs = drawData.drawStartY & 7;
-
-                    //First and last bytes are tricky
-                    if(yofs)
-                    {
-                        uint8_t endFirst = min((drawStartByte + 1) * 8, drawData.drawEndY);
-                        uint8_t bm = fastlshift8(yofs);
-
-                        for (uint8_t i = drawData.drawStartY; i < endFirst; i++)
-                        {
-                            _SPRITEBITUNROLL(bm, (~bm));
-                            bm <<= 1;
-                        }
-
-                        //Move to next, like it never happened
-                        RCMASKTOP(shading, shade, yofs);
-                        _SPRITEWRITESCRNEXT();
-                        _SPRITEREADSCRBYTE();
-                        shade = shading.shading;
-                    }
-
-                    //Now the unrolled loop
-                    while (thisWallByte < drawEndByte)
-                    {
-                        _SPRITEBITUNROLL(0b00000001, 0b11111110);
-                        _SPRITEBITUNROLL(0b00000010, 0b11111101);
-                        _SPRITEBITUNROLL(0b00000100, 0b11111011);
-                        _SPRITEBITUNROLL(0b00001000, 0b11110111);
-                        _SPRITEBITUNROLL(0b00010000, 0b11101111);
-                        _SPRITEBITUNROLL(0b00100000, 0b11011111);
-                        _SPRITEBITUNROLL(0b01000000, 0b10111111);
-                        _SPRITEBITUNROLL(0b10000000, 0b01111111);
-                        _SPRITEWRITESCRNEXT();
-                        _SPRITEREADSCRBYTE();
-                    }
-
-                    yofs = drawData.drawEndY & 7;
-
-                    //Last byte, but only need to do it if we end in the middle of a byte and don't simply span one byte
-                    if(yofs && drawStartByte != drawEndByte)
-                    {
-                        uint8_t endStart = thisWallByte * 8;
-                        uint8_t bm = fastlshift8(endStart & 7);
-                        for (uint8_t i = endStart; i < drawData.drawEndY; i++)
-                        {
-                            _SPRITEBITUNROLL(bm, (~bm));
-                            bm <<= 1;
-                        }
-
-                        //Only need to set the last byte if we're drawing in it of course
-                        RCMASKBOTTOM(shading, shade, yofs);
-                        _SPRITEWRITESCRNEXT();
-                    }
-
-                    #else // No loop unrolling
-
-                    uint8_t y = drawData.drawStartY;
-
-                    //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
-                    if((drawData.drawStartY & 7) == 0) thisWallByte--;
-
-                    do
-                    {
-                        uint8_t bidx = y & 7;
-
-                        // Every new byte, save the current (previous) byte and load the new byte from the screen. 
-                        // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
-                        if(bidx == 0) {
-                            _SPRITEWRITESCRNEXT();
-                            _SPRITEREADSCRBYTE();
-                        }
-
-                        uint8_t bm = fastlshift8(bidx);
-                        _SPRITEBITUNROLL(bm, ~bm);
-                        if(fullstep) { texMask >>= fullstep; texData >>= fullstep; }
-                    }
-                    while(++y < drawData.drawEndY); //EXCLUSIVE
-
-                    //The above loop specifically CAN'T reach the last byte, so although it's wasteful in the case of a 
-                    //sprite ending at the bottom of the screen, it's still better than always incurring an if statement... maybe.
-                    //if(drawData.drawEndY & 7)
-                    _SPRITEWRITESCRNEXT();
-                    //sbuffer[bofs] = texByte;
-
-                    #endif
-
-                }
-
-                SKIPSPRITESTRIPE:
-                //This ONE step is why there has to be a big if statement up there. 
-                texX += drawData.stepX;
-            }
-            while(++x < drawData.drawEndX); //EXCLUSIVE
-            // ------- END CRITICAL SECTION -------------
-
-        }
-    }
-};
+#pragma once
+
+#include <FixedPoints.h>
+#include <Arduboy2.h>
+
+#include "ArduboyRaycast_Utils.h"
+#include "ArduboyRaycast_Map.h"
+#include "ArduboyRaycast_MapPager.h"
+#include "ArduboyRaycast_Player.h"
+#include "ArduboyRaycast_SpriteGroup.h"
+#include "ArduboyRaycast_Shading.h"
+#include "ArduboyRaycast_Profile.h"
+#include "ArduboyRaycast_RayCache.h"
+#include "ArduboyRaycast_Scaler.h"
+
+// Available flags for compilation
+// #define RCSMALLLOOPS           // The raycaster makes use of loop unrolling, which adds about 1.5kb code. This removes that but performance severely drops
+// #define RCINTEGERPROJECTION    // Project walls using the reciprocal table instead of float math. Faster, but line heights may be off by a pixel
+// #define RCLARGEMAP             // 16 bit map indices, for maps larger than 16x16. Slightly slower DDA
+// #define RCCACHERAYS            // Keep per-column ray directions in RAM, only recalculated when the player turns. Uses 8 bytes per column!
+// #define RCRENDERSTATS          // Count per-frame rendering work into render.stats (see ArduboyRaycast_Profile.h). Costs RAM + speed, benchmarking only
+// #define RCPROFILE              // Time each rendering phase into render.profiler (see ArduboyRaycast_Profile.h). Costs RAM + speed
+// #define RCSHADINGTABLE         // Look distance shading up in a RAM table (rebuilt by setLightIntensity) instead of calculating it per column + stripe. Distance steps are slightly coarser
+// #define RCSHADINGTABLESIZE 64  // Entries in the shading table, 1 byte each
+// #define RCFLOORCASTING         // Texture the floor + ceiling with render.floorTile / ceilingTile (see drawFloorCeiling). Uses about VIEWWIDTH + VIEWHEIGHT / 2 bytes RAM, and is slow: see floorBudget
+// #define RCWALLLOD              // Walls past render.lodDistance are a flat dither instead of textured, and fully shaded walls are a flat fill (see fillWallLine)
+// #define RCWALLMIPMAPS          // Draw distant walls from 8x8 / 4x4 versions of the tilesheet (render.tilesheet8 etc), if given. Faster + less shimmer, costs progmem
+// #define RCSPRITEMIPMAPS        // Draw small sprites from 8x8 / 4x4 versions of the spritesheet (render.spritesheet8 etc), if given. Faster + less aliasing, costs progmem
+// #define RCWALLSCALERS          // Draw tall walls with scalers precalculated by the compiler (see ArduboyRaycast_Scaler.h) instead of stepping through every pixel. They draw the exact texels, so differ from the stepped walls on about a tenth of their pixels
+// #define RCWALLSCALERBUDGET 1024 // Most progmem the scalers can use. Walls from twice the tile size up get scalers until this runs out, taller walls step every pixel
+// #define RCINTERLEAVEDSHEETS    // The tilesheet + spritesheet are interleaved (see RcInterleavedSheet / RcInterleavedSprites) so each strip is one read. The spritesheet includes the mask, spritesheet_mask is unused
+// #define RCSPECIALIZEKERNELS    // Compile the wall + sprite drawing loops for black and for white shading, picked per column / sprite instead of checked per byte. Measured 6-11% faster bench_render frames on PC (1% with RCSMALLLOOPS) for about a third more renderer progmem (a tenth with RCSMALLLOOPS); not yet timed on AVR
+
+// Debug flags 
+// #define RCGENERALDEBUG       // Must be set for any of the othere to work
+// #define RCLINEHEIGHTDEBUG      // Display information about lineheight (only draws a few lines)
+// #define RCPRINTSPRITEDATA      // Display information about certain sprite-related properties
+
+#ifdef RCGENERALDEBUG
+#include <Tinyfont.h>
+#endif
+
+// -------------- CALCULATED / ASSUMED CONSTANTS, TRY NOT TO TOUCH ------------------------
+constexpr uint8_t BWIDTH = WIDTH >> 3;
+// Some assumptions (please try to follow these instead of changing them)
+constexpr uint8_t RCEMPTY = 0;
+constexpr uint8_t RCTILESIZE = 16;  // Default tile size (see RcTileStrips for the others)
+// ------------------------------------------------------------------------------
+
+
+// A container for precalculated sprite information. These are calculations we
+// don't want to do per-frame
+struct RcSpriteDrawPrecalc
+{
+    float fposX;
+    float fposY;
+    float invDet;
+};
+
+// A container for calculated sprite draw data. You know a calculation was not performed
+// if stepX and stepY are 0
+struct RcSpriteDrawData
+{
+    uint8_t drawStartX;
+    uint8_t drawStartY;
+    uint8_t drawEndY;
+    uint8_t drawEndX;
+
+    uflot texXInit;
+    uflot texYInit;
+    uflot stepX = 0;
+    uflot stepY = 0;
+
+    uflot transformY;
+    uint8_t mipmap = 0;     // 0 = 16x16, 1 = 8x8, 2 = 4x4 (only with RCSPRITEMIPMAPS)
+};
+
+// A wall line projected onto the screen, along with the texture stepping needed to draw it.
+// This only depends on the wall distance, so columns at the same distance can share one
+struct RcWallLine
+{
+    uint8_t yStart;
+    uint8_t yEnd;       // EXCLUSIVE
+    uint8_t fullstep;   // Whole texels to skip per pixel
+    uint8_t accustep;   // Fractional texel step per pixel (for the overflow accumulator)
+    uint8_t accum;      // Starting fractional texel position
+    uint8_t texShift;   // Starting whole texel position
+    uint8_t mipmap;     // 0 = 16x16, 1 = 8x8, 2 = 4x4 (only with RCWALLMIPMAPS)
+    uint8_t scaler;     // Which wall scaler draws this, starting from 1. 0 = step every pixel (only with RCWALLSCALERS)
+};
+
+// One row of the floor (and its mirror on the ceiling) being cast across the screen, see
+// RcRender::drawFloorCeiling. Positions are world coordinates in 16.16 fixed point
+struct RcFloorSpan
+{
+    int32_t x;
+    int32_t y;
+    int32_t stepX;
+    int32_t stepY;
+    const uint8_t * texture;
+    uint8_t offset;     // Rows from the horizon
+    uint8_t shade;      // Bit n is whether shading lets the texture through at screen x & 3 == n
+};
+
+enum RcShadingType : uint8_t
+{
+    None,
+    Black,
+    White
+};
+
+struct RcShadeInfo
+{
+    uint8_t shading;
+    RcShadingType type;
+};
+
+#define RCMASKTOP(shading, shade, yofs) \
+    if(shading.type == RcShadingType::White) shade &= pgm_read_byte(shade_mask + yofs); \
+    else shade |= ~pgm_read_byte(shade_mask + yofs);
+#define RCMASKBOTTOM(shading, shade, yofs) \
+    if(shading.type == RcShadingType::White) shade &= ~pgm_read_byte(shade_mask + yofs); \
+    else shade |= pgm_read_byte(shade_mask + yofs);
+
+// Template argument for the drawing kernels (drawWallLine, drawSpriteStripes) meaning the setting
+// is read at runtime rather than compiled in, see RCSPECIALIZEKERNELS
+constexpr uint8_t RCKERNELDYNAMIC = 0xFF;
+
+// How to read one strip (column) of a tile or sprite frame for each supported tile size. The strip
+// is returned with the top texel in bit 0, so Strip must have at least TileSize bits. Sheets are in 
+// the regular arduboy image format, one tile after the other, or with RCINTERLEAVEDSHEETS, the 
+// interleaved format (see RcInterleavedSheet). Interleaved sprite sheets hold the mask too
+template<uint8_t TileSize> struct RcTileStrips;
+
+template<> struct RcTileStrips<8>
+{
+    typedef uint8_t Strip;
+    static inline Strip read(const uint8_t * tex, uint8_t tile, uint8_t strip) { return readTextureStrip8(tex, tile, strip); }
+    static inline void readSprite(const uint8_t * sheet, const uint8_t * mask, uint8_t frame, uint8_t strip, Strip & data, Strip & dataMask)
+    {
+        #ifdef RCINTERLEAVEDSHEETS
+        (void)mask;
+        readInterleavedSprite8(sheet, frame, strip, data, dataMask);
+        #else
+        data = readTextureStrip8(sheet, frame, strip);
+        dataMask = readTextureStrip8(mask, frame, strip);
+        #endif
+    }
+};
+
+template<> struct RcTileStrips<16>
+{
+    typedef uint16_t Strip;
+    static inline Strip read(const uint8_t * tex, uint8_t tile, uint8_t strip) 
+    { 
+        #ifdef RCINTERLEAVEDSHEETS
+        return readInterleavedStrip16(tex, tile, strip);
+        #else
+        return readTextureStrip16(tex, tile, strip); 
+        #endif
+    }
+    static inline void readSprite(const uint8_t * sheet, const uint8_t * mask, uint8_t frame, uint8_t strip, Strip & data, Strip & dataMask)
+    {
+        #ifdef RCINTERLEAVEDSHEETS
+        (void)mask;
+        readInterleavedSprite16(sheet, frame, strip, data, dataMask);
+        #else
+        data = readTextureStrip16(sheet, frame, strip);
+        dataMask = readTextureStrip16(mask, frame, strip);
+        #endif
+    }
+};
+
+template<> struct RcTileStrips<32>
+{
+    typedef uint32_t Strip;
+    static inline Strip read(const uint8_t * tex, uint8_t tile, uint8_t strip) 
+    { 
+        #ifdef RCINTERLEAVEDSHEETS
+        return readInterleavedStrip32(tex, tile, strip);
+        #else
+        return readTextureStrip32(tex, tile, strip); 
+        #endif
+    }
+    static inline void readSprite(const uint8_t * sheet, const uint8_t * mask, uint8_t frame, uint8_t strip, Strip & data, Strip & dataMask)
+    {
+        #ifdef RCINTERLEAVEDSHEETS
+        (void)mask;
+        readInterleavedSprite32(sheet, frame, strip, data, dataMask);
+        #else
+        data = readTextureStrip32(sheet, frame, strip);
+        dataMask = readTextureStrip32(mask, frame, strip);
+        #endif
+    }
+};
+
+// The fractional accumulators used to step through textures: add the step to the accumulator,
+// and when it overflows, shift the strip(s) right one texel. The compiler refuses to use the carry
+// bit for this, so on AVR the 8 and 16 bit strips get asm versions; anything else (and host 
+// builds, see extras/bench) uses the C fallback
+template<typename Strip>
+inline void rcAccumulate(uint8_t & accum, uint8_t step, Strip & tex)
+{
+    uint16_t sum = accum + step;
+    accum = sum;
+    if(sum & 0x100) tex >>= 1;
+}
+
+template<typename Strip>
+inline void rcAccumulate(uint8_t & accum, uint8_t step, Strip & tex, Strip & mask)
+{
+    uint16_t sum = accum + step;
+    accum = sum;
+    if(sum & 0x100) { tex >>= 1; mask >>= 1; }
+}
+
+#ifdef __AVR__
+inline void rcAccumulate(uint8_t & accum, uint8_t step, uint8_t & tex)
+{
+    asm volatile(
+        "add %[accum], %[step]    \n"
+        "brcc .+2       \n"
+        "lsr %[td]      \n"
+        : [accum] "+&r" (accum),
+          [td] "+&r" (tex)
+        : [step] "r" (step)
+    );
+}
+
+inline void rcAccumulate(uint8_t & accum, uint8_t step, uint16_t & tex)
+{
+    asm volatile(
+        "add %[accum], %[step]    \n"
+        "brcc .+4       \n"
+        "lsr %B[td]     \n"
+        "ror %A[td]     \n"
+        : [accum] "+&r" (accum),
+          [td] "+&r" (tex)
+        : [step] "r" (step)
+    );
+}
+
+inline void rcAccumulate(uint8_t & accum, uint8_t step, uint8_t & tex, uint8_t & mask)
+{
+    asm volatile(
+        "add %[accum], %[step]    \n"
+        "brcc .+4       \n"
+        "lsr %[td]      \n"
+        "lsr %[td2]     \n"
+        : [accum] "+&r" (accum),
+          [td] "+&r" (tex),
+          [td2] "+&r" (mask)
+        : [step] "r" (step)
+    );
+}
+
+inline void rcAccumulate(uint8_t & accum, uint8_t step, uint16_t & tex, uint16_t & mask)
+{
+    asm volatile(
+        "add %[accum], %[step]    \n"
+        "brcc .+8       \n"
+        "lsr %B[td]     \n"
+        "ror %A[td]     \n"
+        "lsr %B[td2]     \n"
+        "ror %A[td2]     \n"
+        : [accum] "+&r" (accum),
+          [td] "+&r" (tex),
+          [td2] "+&r" (mask)
+        : [step] "r" (step)
+    );
+}
+#endif
+
+// Raycast renderer container, tracks data used for raycasting + lets you render raycasting.
+// TileSize is the size of tiles + sprites in the sheets: 8, 16 or 32 (see RcTileStrips). Smaller
+// tiles read fewer bytes and shift through smaller strips, so they're cheaper to draw
+template<uint8_t W, uint8_t H, uint8_t TileSize = RCTILESIZE>
+class RcRender
+{
+public:
+    typedef RcTileStrips<TileSize> Strips;
+    typedef typename Strips::Strip TexStrip;
+
+    static constexpr uint8_t TILESIZE = TileSize;
+    static constexpr uint8_t VIEWWIDTH = W;
+    static constexpr uint8_t VIEWHEIGHT = H;
+    static constexpr uint8_t VIEWHEIGHTBYTES = VIEWHEIGHT >> 3;
+    static constexpr uint8_t MIDSCREENY = VIEWHEIGHT / 2;
+    static constexpr uint8_t MIDSCREENX = VIEWWIDTH / 2;
+    static constexpr uflot INVWIDTH = 1.0 / VIEWWIDTH;
+    static constexpr float INVHEIGHT = 1.0 / VIEWHEIGHT;
+    static constexpr flot INVWIDTH2 = 2.0f / VIEWWIDTH;
+    static constexpr uint16_t MAXLHEIGHT = 32768;
+    static constexpr float MINLDISTANCE = 1.0f / MAXLHEIGHT;
+    static constexpr float MINSPRITEDISTANCE = 0.2;
+    static constexpr uflot SPRITEVIEWEXENTSION = 1;
+    // Distance (uflot internal) to texture step (16.16 internal), for RCINTEGERPROJECTION. Rounded, so 
+    // it's within 0.5 of the real scale; over a whole wall that drifts at most VIEWHEIGHT / 512 texels
+    static constexpr uint16_t INTSTEPSCALE = (TILESIZE * 256 + VIEWHEIGHT / 2) / VIEWHEIGHT;
+
+    #ifdef RCWALLSCALERS
+    // Below twice the tile size, a page only has a few pixels per texel and stepping them is just as fast
+    typedef RcWallScaler<VIEWHEIGHT, TileSize> Scaler;
+    static_assert(RCWALLSCALERBUDGET >= Scaler::RECORDBYTES, "RCWALLSCALERBUDGET is too small for even one wall scaler");
+    static constexpr uint8_t SCALERMINHALF = TileSize;
+    static constexpr uint8_t SCALERMAXHALF = TileSize + RCWALLSCALERBUDGET / Scaler::RECORDBYTES - 1 < 255 ? 
+        TileSize + RCWALLSCALERBUDGET / Scaler::RECORDBYTES - 1 : 255;
+    typedef RcWallScalerTable<VIEWHEIGHT, TileSize, SCALERMINHALF, SCALERMAXHALF> Scalers;
+    #endif
+
+    uflot lightintensity = 1.0;     // Impacts view distance + shading even when no shading applied
+    const uint8_t * tilesheet = NULL;
+    #ifdef RCWALLMIPMAPS
+    // Smaller versions of the tilesheet, with tiles in the same order (see readTextureStrip8/4)
+    const uint8_t * tilesheet8 = NULL;
+    const uint8_t * tilesheet4 = NULL;
+    #endif
+    const uint8_t * spritesheet = NULL;
+    const uint8_t * spritesheet_mask = NULL;
+    #ifdef RCSPRITEMIPMAPS
+    // Smaller versions of the spritesheet + mask, with frames in the same order (see readTextureStrip8/4).
+    // Each level is only used if both its sheet and mask are set
+    const uint8_t * spritesheet8 = NULL;
+    const uint8_t * spritesheet_mask8 = NULL;
+    const uint8_t * spritesheet4 = NULL;
+    const uint8_t * spritesheet_mask4 = NULL;
+    #endif
+    muflot spritescaling[4] = { 1.5, 1.0, 0.5, 0.25 };
+
+    #ifdef RCFLOORCASTING
+    uint8_t floorTile = RCEMPTY;        // Tile from the tilesheet to cast on the floor. RCEMPTY leaves the background
+    uint8_t ceilingTile = RCEMPTY;      // Same for the ceiling
+    uint16_t floorBudget = 0xFFFF;      // Most floor + ceiling pixels to cast per frame, never exceeded. The pages nearest the player go first, the rest are left as the background
+    #endif
+
+    uint8_t cornershading = 1;
+    RcShadingType shading = RcShadingType::Black;
+    RcShadingType altWallShading = RcShadingType::Black;
+    RcShadingType spriteShading = RcShadingType::None; //Sprite shading is kinda weird
+
+    #ifdef RCWALLLOD
+    uflot lodDistance = 0;              // Walls at least this far away skip the texture and are filled with lodFill. 0 = never
+    uint8_t lodFill = BAYERGRADIENTS / 2; // Bayer gradient for walls past lodDistance (0 = white, BAYERGRADIENTS = black), before shading
+    #endif
+
+    // I want these to be private but they're needed elsewhere
+    uflot _viewdistance = 4.0;      // Calculated value
+    uflot _darkness = 1.0;          // Calculated value
+    uflot _distCache[VIEWWIDTH / 2]; // Half distance resolution means sprites will clip 1 pixel into walls sometimes but otherwise...
+
+    #ifdef RCSHADINGTABLE
+    RcShadingTable<RCSHADINGTABLESIZE> _shadeTable;
+    #endif
+
+    #ifdef RCFLOORCASTING
+    uint8_t _wallHalf[VIEWWIDTH];       // Half the wall height per column from the last raycastWalls, 0 = no wall
+    uflot _rowDistance[MIDSCREENY];     // Distance to the floor for each row out from the horizon, calculated once
+    #endif
+
+    #ifdef RCCACHERAYS
+    RcRayCache<VIEWWIDTH> _rays;
+    #endif
+
+    #ifdef RCGENERALDEBUG
+    Tinyfont * tinyfont;
+    #endif
+
+    #ifdef RCRENDERSTATS
+    RcRenderStats<VIEWWIDTH> stats;
+    #endif
+
+    #ifdef RCPROFILE
+    RcProfiler profiler;
+    #endif
+
+    RcRender()
+    {
+        #ifdef RCSHADINGTABLE
+        // For the starting light intensity, setLightIntensity rebuilds it after that
+        this->_shadeTable.build(this->_viewdistance, this->_darkness);
+        #endif
+        #ifdef RCFLOORCASTING
+        // Each floor row is always the same distance away, wherever the player is
+        for(uint8_t k = 0; k < MIDSCREENY; k++)
+            this->_rowDistance[k] = (float)VIEWHEIGHT / (2 * k + 1);
+        #endif
+    }
+
+    // Clear the area represented by this raycaster
+    inline void clearRaycast(Arduboy2Base * arduboy)
+    {
+        fastClear(arduboy, 0, 0, VIEWWIDTH, VIEWHEIGHT);
+    }
+
+    // Draw a fast(?) raycast background, assumed to start at 0,0. Your background should
+    // NOT have the usual width/height. Will underdraw in the Y direction if VIEWHEIGHT not 
+    // a multiple of 8
+    inline void drawRaycastBackground(Arduboy2Base * arduboy, const uint8_t * bg)
+    {
+        RCPROFILESTART(t);
+        for(uint8_t i = 0; i < VIEWHEIGHTBYTES; ++i)
+            memcpy_P(arduboy->sBuffer + i * WIDTH, bg + i * VIEWWIDTH, VIEWWIDTH);
+        RCPROFILEMARK(t, RcProfilePhase::Background);
+    }
+
+    // Calculate the appropriate shading for this wall slice given our rendering config
+    inline RcShadeInfo calculateShading(uflot distance, uint8_t x, RcShadingType shading)
+    {
+        if(shading == RcShadingType::None)
+        {
+            return RcShadeInfo {
+                0xFF,
+                RcShadingType::Black
+            };
+        }
+        else
+        {
+            RcShadeInfo result {
+                #ifdef RCSHADINGTABLE
+                this->_shadeTable.shade(distance, x),
+                #else
+                calcShading(distance, x, this->_darkness),
+                #endif
+                shading
+            };
+            if(shading == RcShadingType::White)
+                result.shading = ~result.shading;
+            return result;
+        }
+    }
+
+    // Offset into b_shading (bayer gradient * 4) that calculateShading would use for the distance, 
+    // 0xFF if fully shaded. For drawing which shades more than one column at a time
+    inline uint8_t calculateShadingOffset(uflot distance)
+    {
+        #ifdef RCSHADINGTABLE
+        return this->_shadeTable.offset(distance);
+        #else
+        uint8_t level = calcShadingLevel(distance, this->_darkness);
+        return level >= BAYERGRADIENTS ? 0xFF : level << 2;
+        #endif
+    }
+
+    // Set the light intensity for raycasting. Performs several expensive calculations, only set this
+    // when necessary
+    void setLightIntensity(uflot intensity)
+    {
+        // Skip complicated calcs
+        if(intensity == this->lightintensity)
+            return;
+
+        this->lightintensity = intensity;
+        this->_viewdistance = sqrt(BAYERGRADIENTS * (float)intensity);
+        this->_darkness = 1 / intensity;
+        #ifdef RCSHADINGTABLE
+        this->_shadeTable.build(this->_viewdistance, this->_darkness);
+        #endif
+    }
+
+    // The full function for raycasting. Works with any map type that has getIndex, getTile and
+    // width (RcMap or RcPackedMap)
+    template<typename MapType>
+    void raycastWalls(RcPlayer * p, MapType * map, Arduboy2Base * arduboy)
+    {
+        uint8_t pmapX = p->posX.getInteger();
+        uint8_t pmapY = p->posY.getInteger();
+        rcmapindex startMapIndex = map->getIndex(pmapX, pmapY);
+        uflot pmapofsX = p->posX - pmapX;
+        uflot pmapofsY = p->posY - pmapY;
+        flot fposX = (flot)p->posX, fposY = (flot)p->posY;
+        #ifndef RCCACHERAYS
+        flot dX = p->dirX, dY = p->dirY;
+        #endif
+        const uint8_t * tilesheet = this->tilesheet;
+        uflot viewdistance = this->_viewdistance;
+        uflot * distCache = this->_distCache;
+
+        RCSTAT(this->stats.reset();)
+
+        #ifdef RCCACHERAYS
+        RcRayCache<VIEWWIDTH> * rays = &this->_rays;
+        rays->update(p->dirX, p->dirY);
+        #endif
+        RCPROFILESTART(t);
+
+        //RcShadeInfo shade;
+        uint8_t texX = 0;
+        TexStrip texData = 0;
+
+        // Adjacent columns sometimes hit the same wall at the same distance (a wall facing the player 
+        // head-on, or far walls only a few texels wide). Remember the last projection and texture 
+        // strip so those runs skip the float math and PROGMEM reads. Only exact matches are reused,
+        // so a wall seen at an angle only gets this where its distance moves less than 1/256 per 
+        // column, which is mostly far away. On bench_render's camera paths (mostly on the grid) 
+        // 40-60% of wall columns reuse the projection and 40-80% the strip, see linesReused and 
+        // stripsReused in RCRENDERSTATS. Angled walls close up reuse next to nothing
+        RcWallLine line;
+        uflot lastDistance = 0;
+        bool lastLineValid = false;
+        #ifdef RCWALLLOD
+        bool lineDark = false;          // Fully shaded, so the texture doesn't matter
+        #endif
+        uint8_t lastTile = RCEMPTY;
+        uint8_t lastTexX = 0;
+        uint8_t lastMipmap = 0;
+        TexStrip lastTexData = 0;
+
+        for (uint8_t x = 0; x < VIEWWIDTH; x++)
+        {
+            #ifdef RCCACHERAYS
+            // Everything here was calculated when the player last turned. The deltas are already
+            // reciprocals, and are 0 (so fail the check below) if that direction isn't stepped
+            flot rayDirX = rays->rayDirX[x];
+            flot rayDirY = rays->rayDirY[x];
+            uflot deltaDistX = rays->deltaDistX[x];
+            uflot deltaDistY = rays->deltaDistY[x];
+            #else
+            flot cameraX = x * INVWIDTH2 - 1; // x-coordinate in camera space
+
+            // The camera plane is a simple -90 degree rotation on the player direction (as required for this algorithm).
+            flot rayDirX = dX + dY * cameraX;
+            flot rayDirY = dY - dX * cameraX;
+
+            // length of ray from one x or y-side to next x or y-side. But we prefill it with
+            // some initial data which has to be massaged later.
+            uflot deltaDistX = (uflot)abs(rayDirX); //Temp value; may not be used
+            uflot deltaDistY = (uflot)abs(rayDirY); //same
+            #endif
+
+            // length of ray from current position to next x or y-side
+            uflot sideDistX = MAXFIXED;
+            uflot sideDistY = MAXFIXED;
+
+            // what direction to step in x or y-direction (either +1 or -1)
+            int8_t stepX = 0;
+            rcmapstep stepY = 0;
+
+            // With this DDA stepping algorithm, have to be careful about making too-large values
+            // with our tiny fixed point numbers. Make some arbitrarily small cutoff point for
+            // even trying to deal with steps in that direction. As long as the map size is 
+            // never larger than 1 / NEARZEROFIXED on any side, it will be fine (that means
+            // map has to be < 100 on a side with this)
+            if(deltaDistX > NEARZEROFIXED) {
+                #ifndef RCCACHERAYS
+                deltaDistX = uReciprocalNearUnit(deltaDistX); 
+                #endif
+                if (rayDirX < 0) {
+                    stepX = -1;
+                    sideDistX = pmapofsX * deltaDistX;
+                }
+                else {
+                    stepX = 1;
+                    sideDistX = (1 - pmapofsX) * deltaDistX;
+                }
+            }
+            if(deltaDistY > NEARZEROFIXED) {
+                #ifndef RCCACHERAYS
+                deltaDistY = uReciprocalNearUnit(deltaDistY); 
+                #endif
+                if (rayDirY < 0) {
+                    stepY = -map->width;
+                    sideDistY = pmapofsY * deltaDistY;
+                }
+                else {
+                    stepY = map->width;
+                    sideDistY = (1 - pmapofsY) * deltaDistY;
+                }
+            }
+
+            uint8_t side;           // was a NS or a EW wall hit?
+            rcmapindex mapIndex = startMapIndex;
+            uflot perpWallDist = 0;   // perpendicular distance (not real distance)
+            uint8_t tile;
+            RCSTAT(uint8_t ddaSteps = 0;)
+
+            // perform DDA. A do/while loop is ever-so-slightly faster it seems?
+            do
+            {
+                RCSTAT(ddaSteps++;)
+                // jump to next map square, either in x-direction, or in y-direction
+                if (sideDistX < sideDistY) {
+                    perpWallDist = sideDistX; // Remember that sideDist is actual distance and not distance only in 1 direction
+                    sideDistX += deltaDistX;
+                    mapIndex += stepX;
+                    side = 0; //0 = xside hit
+                }
+                else {
+                    perpWallDist = sideDistY;
+                    sideDistY += deltaDistY;
+                    mapIndex += stepY;
+                    side = 1; //1 = yside hit
+                }
+                tile = map->getTile(mapIndex);
+            }
+            while (perpWallDist < viewdistance && tile == RCEMPTY);
+
+            RCSTAT(this->stats.recordColumn(x, ddaSteps);)
+
+            //Only calc distance for every other point to save a lot of memory (100 bytes)
+            if((x & 1) == 0)
+                distCache[x >> 1] = perpWallDist;
+
+            #ifdef RCFLOORCASTING
+            this->_wallHalf[x] = 0;
+            #endif
+
+            // If the above loop was exited without finding a tile, there's nothing to draw
+            if(tile == RCEMPTY) continue;
+
+            if(!lastLineValid || perpWallDist != lastDistance)
+            {
+                line = calcWallLine(perpWallDist);
+                lastDistance = perpWallDist;
+                lastLineValid = true;
+                #ifdef RCWALLLOD
+                lineDark = this->shading != RcShadingType::None && this->calculateShadingOffset(perpWallDist) == 0xFF;
+                #endif
+            }
+            RCSTAT(else this->stats.linesReused++;)
+
+            #ifdef RCFLOORCASTING
+            this->_wallHalf[x] = MIDSCREENY - line.yStart;
+            #endif
+
+            #ifdef RCWALLLOD
+            // Far walls skip the texture (and distance shading math if it would be fully shaded anyway)
+            if(lineDark)
+            {
+                fillWallLine(x, line, this->shading == RcShadingType::White ? 0xFF : 0x00, arduboy);
+                continue;
+            }
+            if(this->lodDistance.getInternal() && perpWallDist >= this->lodDistance)
+            {
+                uint8_t fill;
+                if((side & x) && this->altWallShading != RcShadingType::None)
+                    fill = this->altWallShading == RcShadingType::Black ? 0x00 : 0xFF;
+                else
+                    fill = pgm_read_byte(b_shading + (this->lodFill << 2) + (x & 3));
+                RcShadeInfo shading = this->calculateShading(perpWallDist, x, this->shading);
+                fillWallLine(x, line, shading.type == RcShadingType::Black ? (fill & shading.shading) : (fill | shading.shading), arduboy);
+                continue;
+            }
+            #endif
+
+            #ifdef RCWALLMIPMAPS
+            uint8_t texSize = TILESIZE >> line.mipmap;
+            #else
+            constexpr uint8_t texSize = TileSize;
+            #endif
+
+            //NOTE: wallX technically can only be positive, but I'm using flot to save a tiny amount from casting
+            flot wallX = side ? fposX + (flot)perpWallDist * rayDirX : fposY + (flot)perpWallDist * rayDirY;
+            wallX -= floorFixed(wallX); //.getFraction isn't working!
+            texX = uint8_t(wallX * texSize);
+            if((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = texSize - 1 - texX;
+
+            if((side & x) && this->altWallShading != RcShadingType::None)
+            {
+                texData = this->altWallShading == RcShadingType::Black ? 0 : (TexStrip)~0;
+            }
+            else
+            {
+                if(tile != lastTile || texX != lastTexX || line.mipmap != lastMipmap)
+                {
+                    #ifdef RCWALLMIPMAPS
+                    if(line.mipmap == 2)
+                        lastTexData = readTextureStrip4(this->tilesheet4, tile, texX);
+                    else if(line.mipmap == 1)
+                        lastTexData = readTextureStrip8(this->tilesheet8, tile, texX);
+                    else
+                    #endif
+                    lastTexData = Strips::read(tilesheet, tile, texX);
+                    lastTile = tile;
+                    lastTexX = texX;
+                    lastMipmap = line.mipmap;
+                }
+                RCSTAT(else this->stats.stripsReused++;)
+                texData = lastTexData;
+            }
+
+            #ifdef RCLINEHEIGHTDEBUG
+            tinyfont.setCursor(16, x * 16);
+            tinyfont.println(lineHeight);
+            tinyfont.setCursor(16, x * 16 + 8);
+            tinyfont.println((float)perpWallDist);
+            if(x > 2) break;
+            #endif
+
+            //ending should be exclusive
+            #ifdef RCSPECIALIZEKERNELS
+            drawWallKernel(x, line, this->calculateShading(perpWallDist, x, this->shading), texData, arduboy);
+            #else
+            drawWallLine(x, line, this->calculateShading(perpWallDist, x, this->shading), texData, arduboy);
+            #endif
+        }
+
+        RCPROFILEMARK(t, RcProfilePhase::Walls);
+    }
+
+    #ifdef RCFLOORCASTING
+    // Texture the floor and ceiling around the walls from the last raycastWalls, so call this after
+    // raycastWalls and before drawSprites (RcContainer does this for you). Each screen page (8 rows) 
+    // is cast as 8 horizontal spans at once, so the screen is written a whole byte at a time, and 
+    // rows covered by the wall in a column are skipped. Floor rows are the same distance as their
+    // mirror on the ceiling, so both share the per-row distances. Rows past the view distance are
+    // left as the background, and pages are cast nearest first until floorBudget pixels are used.
+    // A row is only cast if all of it fits in what's left of the budget, so it's never overrun
+    void drawFloorCeiling(RcPlayer * p, Arduboy2Base * arduboy)
+    {
+        if(this->floorTile == RCEMPTY && this->ceilingTile == RCEMPTY)
+            return;
+
+        RCPROFILESTART(t);
+
+        constexpr uint8_t TILESHIFT = TileSize == 8 ? 3 : TileSize == 16 ? 4 : 5;
+        constexpr uint8_t TILEBYTES = (TileSize * TileSize) >> 3;
+
+        // The ray at the left edge of the view, and how it changes per column (same as raycastWalls)
+        float rayX = p->dirX - p->dirY;
+        float rayY = p->dirY + p->dirX;
+        float rayStepX = p->dirY * (2.0f / VIEWWIDTH);
+        float rayStepY = -p->dirX * (2.0f / VIEWWIDTH);
+        float posX = (float)p->posX;
+        float posY = (float)p->posY;
+
+        uflot viewdistance = this->_viewdistance;
+        RcShadingType shading = this->shading;
+        uint8_t * wallHalf = this->_wallHalf;
+        uint16_t budget = this->floorBudget;
+        uint16_t cast = 0;
+        bool full = false;
+
+        // How many pixels a row casts: the columns whose wall is no taller than the row's offset.
+        // Count the columns at each wall height, then sum them up
+        uint8_t rowPixels[MIDSCREENY + 1];
+        memset(rowPixels, 0, sizeof(rowPixels));
+        for(uint8_t x = 0; x < VIEWWIDTH; x++)
+            rowPixels[wallHalf[x]]++;
+        for(uint8_t k = 1; k <= MIDSCREENY; k++)
+            rowPixels[k] += rowPixels[k - 1];
+
+        RcFloorSpan spans[8];
+
+        for(uint8_t n = 0; n < VIEWHEIGHTBYTES && !full; n++)
+        {
+            // Alternate between the top and bottom page, working in towards the horizon
+            uint8_t page = (n & 1) ? VIEWHEIGHTBYTES - 1 - (n >> 1) : (n >> 1);
+            uint8_t active = 0;
+
+            for(uint8_t i = 0; i < 8; i++)
+            {
+                uint8_t row = (page << 3) + i;
+                bool floor = row >= MIDSCREENY;
+                uint8_t tile = floor ? this->floorTile : this->ceilingTile;
+                if(tile == RCEMPTY)
+                    continue;
+
+                RcFloorSpan * span = spans + i;
+                span->offset = floor ? row - MIDSCREENY : MIDSCREENY - 1 - row;
+
+                uflot distance = this->_rowDistance[span->offset];
+                if(distance >= viewdistance)
+                    continue;
+
+                span->shade = 0x0F;
+                if(shading != RcShadingType::None)
+                {
+                    uint8_t offset = this->calculateShadingOffset(distance);
+                    if(offset == 0xFF)
+                        continue;
+                    const uint8_t * bayer = b_shading + offset;
+                    span->shade = 0;
+                    for(uint8_t j = 0; j < 4; j++)
+                        if(pgm_read_byte(bayer + j) & fastlshift8(i))
+                            span->shade |= fastlshift8(j);
+                }
+
+                uint8_t pixels = rowPixels[span->offset];
+                if(pixels > budget - cast)
+                {
+                    full = true;
+                    break;
+                }
+                cast += pixels;
+
+                float fdistance = (float)distance * 65536.0f;
+                span->x = (int32_t)(posX * 65536.0f + fdistance * rayX);
+                span->y = (int32_t)(posY * 65536.0f + fdistance * rayY);
+                span->stepX = (int32_t)(fdistance * rayStepX);
+                span->stepY = (int32_t)(fdistance * rayStepY);
+                span->texture = this->tilesheet + tile * TILEBYTES;
+                active |= fastlshift8(i);
+            }
+
+            if(!active)
+                continue;
+
+            uint8_t * screen = arduboy->sBuffer + page * WIDTH;
+
+            // ------- BEGIN CRITICAL SECTION -------------
+            for(uint8_t x = 0; x < VIEWWIDTH; x++)
+            {
+                uint8_t half = wallHalf[x];
+                uint8_t xshade = fastlshift8(x & 3);
+                uint8_t screenByte = screen[x];
+                uint8_t bm = 1;
+
+                for(uint8_t i = 0; i < 8; i++, bm <<= 1)
+                {
+                    if(!(active & bm))
+                        continue;
+
+                    RcFloorSpan * span = spans + i;
+
+                    if(span->offset >= half)
+                    {
+                        bool lit = span->shade & xshade;
+
+                        // Fully shaded pixels don't need the texture
+                        if(lit || shading == RcShadingType::White)
+                        {
+                            uint8_t tx = uint16_t(span->x) >> (16 - TILESHIFT);
+                            uint8_t ty = uint16_t(span->y) >> (16 - TILESHIFT);
+                            #ifdef RCINTERLEAVEDSHEETS
+                            uint8_t texel = pgm_read_byte(span->texture + tx * (TileSize >> 3) + (ty >> 3)) & fastlshift8(ty & 7);
+                            #else
+                            uint8_t texel = pgm_read_byte(span->texture + (ty >> 3) * TileSize + tx) & fastlshift8(ty & 7);
+                            #endif
+                            lit = shading == RcShadingType::White ? (texel || !lit) : texel;
+                        }
+
+                        if(lit) screenByte |= bm;
+                        else screenByte &= ~bm;
+                    }
+
+                    span->x += span->stepX;
+                    span->y += span->stepY;
+                }
+
+                screen[x] = screenByte;
+            }
+            // ------- END CRITICAL SECTION -------------
+        }
+
+        RCSTAT(this->stats.floorPixels = cast;)
+        RCPROFILEMARK(t, RcProfilePhase::Floor);
+    }
+    #endif
+
+    // Project a wall at the given distance onto the screen and figure out how to step through 
+    // the texture for it. 
+    RcWallLine calcWallLine(uflot distance)
+    {
+        RcWallLine result;
+
+        #ifdef RCINTEGERPROJECTION
+        // Line height is the only reciprocal, so pull that from the table. The texture step is 
+        // linear in distance, so that's just a multiply
+        uint16_t lineHeight = min(MAXLHEIGHT, uReciprocalScaled(VIEWHEIGHT, distance));
+        UFixed<16,16> step = UFixed<16,16>::fromInternal((uint32_t)distance.getInternal() * INTSTEPSCALE);
+        #else
+        float invLineHeight = INVHEIGHT * (float)distance; 
+        UFixed<16,16> step = TileSize * invLineHeight;
+
+        uint16_t lineHeight = (invLineHeight <= MINLDISTANCE) ? MAXLHEIGHT : (uint16_t)(1 / invLineHeight);
+        #endif
+
+        result.mipmap = 0;
+
+        #ifdef RCWALLMIPMAPS
+        // Once the wall is drawn at 16 pixels or less, texels start getting skipped, so use the 
+        // smallest level that's still at least 1 pixel per texel. Slightly blurrier than 
+        // the usual mipmap choice, but the texture never needs whole texel skips (fullstep = 0),
+        // except for walls under 4 pixels
+        uint16_t wholeStep = step.getInteger();
+        if(TileSize != 16) {} // The mipmap sheets are 8x8 and 4x4, which only works for 16x16 tiles
+        else if(wholeStep >= 2 && this->tilesheet4)
+            result.mipmap = 2;
+        else if(wholeStep >= 1 && this->tilesheet8)
+            result.mipmap = 1;
+        step = UFixed<16,16>::fromInternal(step.getInternal() >> result.mipmap);
+        #endif
+
+        int16_t halfLine = lineHeight >> 1;
+        result.yStart = max(0, MIDSCREENY - halfLine);
+        result.yEnd = min(VIEWHEIGHT, MIDSCREENY + halfLine); //EXCLUSIVE
+
+        result.scaler = 0;
+        #ifdef RCWALLSCALERS
+        if(result.mipmap == 0 && halfLine >= SCALERMINHALF && halfLine <= SCALERMAXHALF)
+            result.scaler = halfLine - SCALERMINHALF + 1;
+        #endif
+
+        //Everyone prefers the high precision tiles (and for some reason, it's now faster? so confusing...)
+        UFixed<16,16> texPos = (result.yStart + halfLine - MIDSCREENY) * step;
+
+        result.fullstep = step.getInteger();
+        result.accustep = (step.getFraction() >> 8);
+        result.accum = (texPos.getFraction() >> 8);
+        result.texShift = texPos.getInteger();
+
+        return result;
+    }
+
+    //Draw a single raycast wall line. Will only draw specifically the wall line and will clip out all the rest
+    //(so you can predraw a ceiling and floor before calling raycast)
+    inline void drawWallLine(uint8_t x, uflot distance, RcShadeInfo shading, TexStrip texData, Arduboy2Base * arduboy)
+    {
+        drawWallLine(x, calcWallLine(distance), shading, texData, arduboy);
+    }
+
+    #ifdef RCWALLLOD
+    // Fill a projected wall line (see calcWallLine) with a single byte instead of a texture. Only 
+    // the partial bytes at the ends need masking, every page in between is a single write
+    void fillWallLine(uint8_t x, RcWallLine line, uint8_t fill, Arduboy2Base * arduboy)
+    {
+        RCSTAT(this->stats.lodColumns++;)
+
+        uint8_t * screen = arduboy->sBuffer + x;
+        uint8_t startByte = line.yStart;
+        TOBYTECOUNT(startByte);
+        uint8_t endByte = line.yEnd;
+        TOBYTECOUNT(endByte);
+
+        // Wall bits in the first and last byte
+        uint8_t topMask = pgm_read_byte(shade_mask + (line.yStart & 7));
+        uint8_t bottomMask = ~pgm_read_byte(shade_mask + (line.yEnd & 7));
+
+        if(startByte == endByte)
+        {
+            uint8_t mask = topMask & bottomMask;
+            screen[startByte * WIDTH] = (screen[startByte * WIDTH] & ~mask) | (fill & mask);
+            return;
+        }
+
+        screen[startByte * WIDTH] = (screen[startByte * WIDTH] & ~topMask) | (fill & topMask);
+
+        for(uint8_t i = startByte + 1; i < endByte; i++)
+            screen[i * WIDTH] = fill;
+
+        if(line.yEnd & 7)
+        {
+            // Same corner shading as drawWallLine: the pixel just under the wall is cleared
+            uint8_t keep = ~bottomMask;
+            if(this->cornershading) keep &= ~fastlshift8(line.yEnd & 7);
+            screen[endByte * WIDTH] = (screen[endByte * WIDTH] & keep) | (fill & bottomMask);
+        }
+    }
+    #endif
+
+    //Draw a single raycast wall line from an already projected line (see calcWallLine). ShadeType compiles
+    //the shading type into the loops (see drawWallKernel), otherwise it's read from shading
+    template<uint8_t ShadeType = RCKERNELDYNAMIC>
+    void drawWallLine(uint8_t x, RcWallLine line, RcShadeInfo shading, TexStrip texData, Arduboy2Base * arduboy)
+    {
+        // With the type known, every type check in the macros below folds away. calculateShading gives
+        // no shading as black shading that lets everything through, so the black kernel draws that too
+        if(ShadeType != RCKERNELDYNAMIC)
+            shading.type = (RcShadingType)ShadeType;
+        uint8_t cornershading = this->cornershading;
+
+        // ------- BEGIN CRITICAL SECTION -------------
+        uint8_t yStart = line.yStart;
+        uint8_t yEnd = line.yEnd; //EXCLUSIVE
+
+        RCSTAT(this->stats.wallColumns++; this->stats.wallPixels += yEnd - yStart;)
+
+        //These four variables are needed as part of the loop unrolling system
+        uint16_t bofs;
+        uint8_t texByte;
+        uint8_t thisWallByte = yStart;
+        TOBYTECOUNT(thisWallByte);
+        uint8_t * sbuffer = arduboy->sBuffer;
+        uint8_t shade = shading.shading;
+
+        uint8_t fullstep = line.fullstep;
+        uint8_t accustep = line.accustep;
+        uint8_t accum = line.accum;
+
+        //Pull wall byte, save location
+        #define _WALLREADBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs];
+        //Write previously read wall byte, go to next byte
+        #define _WALLWRITENEXT(mixin) if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & shade) mixin; } else { sbuffer[bofs] = (texByte | shade) mixin;} thisWallByte++;
+        //Work for setting bits of wall byte. Use an imperfect overflow accumulator to approximate stepping through texture.
+        #define _WALLBITUNROLL(bm,nbm) \
+            if(texData & 1) texByte |= (bm); \
+            else texByte &= (nbm); \
+            rcAccumulate(accum, accustep, texData);
+        
+        // rcAccumulate is a special fractional accumulator which uses the carry bit to determine
+        // if an additional right shift of the texture is in order
+
+        _WALLREADBYTE();
+
+        #ifdef RCWALLSCALERS
+        if(line.scaler)
+        {
+            // Each page is the texels in it setting or clearing whole runs of bits at once (see
+            // ArduboyRaycast_Scaler.h for the format). The texture is stepped 1 texel at a time 
+            // from the top texel, which the scaler starts with
+            const uint8_t * scaler = Scalers::data + (line.scaler - 1) * Scaler::RECORDBYTES;
+            texData >>= pgm_read_byte(scaler++);
+            uint8_t lastByte = (yEnd - 1) >> 3;
+            uint8_t yofs = yStart & 7;
+            bool lastSet = false;   // Texel continued from the page above
+
+            while(true)
+            {
+                uint8_t count = pgm_read_byte(scaler++);
+                uint8_t carry = pgm_read_byte(scaler++);
+                if(lastSet) texByte |= carry;
+                else texByte &= ~carry;
+
+                while(count--)
+                {
+                    uint8_t mask = pgm_read_byte(scaler++);
+                    lastSet = texData & 1;
+                    if(lastSet) texByte |= mask;
+                    else texByte &= ~mask;
+                    texData >>= 1;
+                }
+
+                if(yofs) 
+                {
+                    RCMASKTOP(shading, shade, yofs);
+                    yofs = 0;
+                }
+
+                if(thisWallByte == lastByte)
+                    break;
+
+                _WALLWRITENEXT();
+                _WALLREADBYTE();
+                shade = shading.shading;
+            }
+
+            // Same end as the loops below
+            yofs = yEnd & 7;
+            if(yofs)
+            {
+                RCMASKBOTTOM(shading, shade, yofs);
+                if(cornershading) { _WALLWRITENEXT(& ~(fastlshift8(yofs))); }
+                else { _WALLWRITENEXT(); }
+            }
+            else
+            {
+                _WALLWRITENEXT();
+            }
+            return;
+        }
+        #endif
+
+        texData >>= line.texShift;
+
+        #ifndef RCSMALLLOOPS
+
+        uint8_t startByte = thisWallByte; //The byte within which we start, always inclusive
+        uint8_t endByte = yEnd;
+        TOBYTECOUNT(endByte);
+
+        uint8_t yofs = yStart & 7;
+
+        //First and last bytes are tricky
+        if(yofs)
+        {
+            uint8_t endFirst = min((startByte + 1) * 8, yEnd);
+            uint8_t bm = fastlshift8(yofs);
+
+            if(fullstep)
+            {
+                for (uint8_t i = yStart; i < endFirst; i++) {
+                    _WALLBITUNROLL(bm, (~bm));
+                    texData >>= fullstep;
+                    bm <<= 1;
+                }
+            }
+            else
+            {
+                for (uint8_t i = yStart; i < endFirst; i++) {
+                    _WALLBITUNROLL(bm, (~bm));
+                    bm <<= 1;
+                }
+            }
+
+            //Move to next, like it never happened (but mask shading)
+            RCMASKTOP(shading, shade, yofs);
+            _WALLWRITENEXT();
+            _WALLREADBYTE();
+            shade = shading.shading;
+        }
+
+        // Now the unrolled loop
+        if(fullstep)
+        {
+            while (thisWallByte < endByte)
+            {
+                _WALLBITUNROLL(0b00000001, 0b11111110);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b00000010, 0b11111101);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b00000100, 0b11111011);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b00001000, 0b11110111);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b00010000, 0b11101111);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b00100000, 0b11011111);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b01000000, 0b10111111);
+                    texData >>= fullstep;
+                _WALLBITUNROLL(0b10000000, 0b01111111);
+                    texData >>= fullstep;
+                _WALLWRITENEXT();
+                _WALLREADBYTE();
+            }
+        }
+        else
+        {
+            while (thisWallByte < endByte)
+            {
+                _WALLBITUNROLL(0b00000001, 0b11111110);
+                _WALLBITUNROLL(0b00000010, 0b11111101);
+                _WALLBITUNROLL(0b00000100, 0b11111011);
+                _WALLBITUNROLL(0b00001000, 0b11110111);
+                _WALLBITUNROLL(0b00010000, 0b11101111);
+                _WALLBITUNROLL(0b00100000, 0b11011111);
+                _WALLBITUNROLL(0b01000000, 0b10111111);
+                _WALLBITUNROLL(0b10000000, 0b01111111);
+                _WALLWRITENEXT();
+                _WALLREADBYTE();
+            }
+        }
+
+        yofs = yEnd & 7;
+        //Last byte, but only need to do it if we don't simply span one byte
+        if(yofs && startByte != endByte)
+        {
+            uint8_t bm = 1;
+            if(fullstep)
+            {
+                for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
+                    _WALLBITUNROLL(bm, (~bm));
+                    texData >>= fullstep;
+                    bm <<= 1;
+                }
+            }
+            else
+            {
+                for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
+                    _WALLBITUNROLL(bm, (~bm));
+                    bm <<= 1;
+                }
+            }
+
+            //"Don't repeat yourself": that ship has sailed. Anyway, only write the last byte if we need to, otherwise
+            //we could legitimately write outside the bounds of the screen.
+            RCMASKBOTTOM(shading, shade, yofs);
+            if(cornershading) { _WALLWRITENEXT(& ~(fastlshift8(yofs))); }
+            else { _WALLWRITENEXT(); }
+        }
+
+        #else // No loop unrolling
+
+        //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
+        if((yStart & 7) == 0) thisWallByte--;
+        uint8_t bm = fastlshift8(yStart & 7);
+
+        do
+        {
+            uint8_t bidx = yStart & 7;
+
+            // Every new byte, save the current (previous) byte and load the new byte from the screen. 
+            // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
+            if(bidx == 0) {
+                bm = 1;
+                _WALLWRITENEXT();
+                _WALLREADBYTE();
+            }
+
+            _WALLBITUNROLL(bm, ~bm);
+            if(fullstep) { texData >>= fullstep; }
+            bm <<= 1;
+        }
+        while(++yStart < yEnd);
+
+        if(cornershading && yEnd != VIEWHEIGHT) { _WALLWRITENEXT(& ~(fastlshift8(yEnd & 7))); }
+        else { _WALLWRITENEXT(); }
+
+        #endif
+
+        // ------- END CRITICAL SECTION -------------
+    }
+
+    #ifdef RCSPECIALIZEKERNELS
+    // Draw with the drawWallLine instance for the shading type, so the type is checked once per column
+    // rather than on every byte written. Only black and white get their own copy of the loops: no 
+    // shading is drawn as black (see drawWallLine). These are direct calls rather than a pointer picked
+    // once per frame, so the compiler can still inline them
+    inline void drawWallKernel(uint8_t x, RcWallLine line, RcShadeInfo shading, TexStrip texData, Arduboy2Base * arduboy)
+    {
+        if(shading.type == RcShadingType::White) drawWallLine<RcShadingType::White>(x, line, shading, texData, arduboy);
+        else drawWallLine<RcShadingType::Black>(x, line, shading, texData, arduboy);
+    }
+    #endif
+
+
+    //Precalculate some sprite drawing stuff, happens before any loop, not tied to a sprite
+    RcSpriteDrawPrecalc precalcSpriteDraw(RcPlayer * player)
+    {
+        RcSpriteDrawPrecalc result;
+
+        result.fposX = (float)player->posX;
+        result.fposY = (float)player->posY;
+        result.invDet = 1.0 / (player->dirY * player->dirY + player->dirX * player->dirX); // required for correct matrix multiplication
+
+        return result;
+    }
+
+    // Setup culling for the sprites this frame. Has to be done after raycastWalls (needs the distance cache)
+    RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> precalcSpriteCull(RcSpriteDrawPrecalc * calc, RcPlayer * player)
+    {
+        RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> result;
+
+        result.posX = calc->fposX;
+        result.posY = calc->fposY;
+        result.dirX = player->dirX;
+        result.dirY = player->dirY;
+        result.invDet = calc->invDet;
+        result.minDepth = MINSPRITEDISTANCE;
+        // Past the view distance, shaded sprites would only be a dark silhouette with no walls around them
+        uflot extension = SPRITEVIEWEXENTSION;
+        result.maxDepth = this->spriteShading == RcShadingType::None ? 0 : (float)(this->_viewdistance + extension);
+        result.scaling = this->spritescaling;
+        result.distCache = this->_distCache;
+
+        return result;
+    }
+
+    template<uint8_t InternalStateBytes>
+    RcSpriteDrawData calcSpriteDraw(RcSpriteDrawPrecalc * calc, RcPlayer * player, RcSprite<InternalStateBytes> * sprite)
+    {
+        RcSpriteDrawData result;
+
+        float spriteX = (float)sprite->x - calc->fposX;
+        float spriteY = (float)sprite->y - calc->fposY;
+
+        float transformYT = calc->invDet * (player->dirX * spriteX + player->dirY * spriteY); // this is actually the depth inside the screen, that what Z is in 3D
+
+        // Nice quick shortcut to get out for sprites behind us (and ones that are too close / far)
+        if (transformYT < MINSPRITEDISTANCE ) //|| transformYT > _viewdistance + SPRITEVIEWEXENTSION) //_sviewdistance)
+            return result;
+
+        float invTransformYT = 1 / transformYT;
+        float transformXT = calc->invDet * (player->dirY * spriteX - player->dirX * spriteY);
+
+        // int16 because easy overflow! if x is much larger than y, then you're effectively multiplying 50 by map width.
+        //  NOTE: this is the CENTER of the sprite, not the edge (thankfully)
+        int16_t spriteScreenX = int16_t(MIDSCREENX * (1 + transformXT * invTransformYT));
+
+        // calculate the dimensions of the sprite on screen. All sprites are square. Size mods go here
+        // using 'transformY' instead of the real distance prevents fisheye
+        float scale = (float)this->spritescaling[(sprite->state & RSSTATESIZE) >> 1];
+        uint16_t spriteHeight = uint16_t(VIEWHEIGHT * invTransformYT * scale);
+        uint16_t spriteWidth = spriteHeight;
+
+        // calculate lowest and highest pixel to fill. Sprite screen/start X and Sprite screen/start Y
+        // Because we have 1 fewer bit to store things, we unfortunately need an int16
+        int16_t ssX = -(spriteWidth >> 1) + spriteScreenX; // Offsets go here, but modified by distance or something?
+        int16_t ssXe = ssX + spriteWidth;                  // EXCLUSIVE
+
+        // Get out if sprite is completely outside view (the ends are exclusive, so touching the edge is outside)
+        if (ssXe <= 0 || ssX >= VIEWWIDTH)
+            return result;
+
+        // Calculate vertical shift from top 5 bits of state
+        uint8_t yShiftBits = sprite->state;
+        TOBYTECOUNT(yShiftBits); //((sprite->state >> 1) >> 1) >> 1;
+        int16_t yShift = yShiftBits ? int16_t((yShiftBits & 16 ? -(yShiftBits & 15) : (yShiftBits & 15)) * max(scale, 1.0) * 2.0 * invTransformYT) : 0;
+        // The above didn't work without float math, didn't feel like figuring out the ridiculous type casting
+
+        int16_t ssY = -(spriteHeight >> 1) + MIDSCREENY + yShift;
+        int16_t ssYe = ssY + spriteHeight; // EXCLUSIVE
+
+        if (ssYe <= 0 || ssY >= VIEWHEIGHT)
+            return result;
+
+        result.drawStartY = ssY < 0 ? 0 : ssY; // Because of these checks, we can store them in 1 byte stuctures
+        result.drawEndY = ssYe > VIEWHEIGHT ? VIEWHEIGHT : ssYe;
+        result.drawStartX = ssX < 0 ? 0 : ssX;
+        result.drawEndX = ssXe > VIEWWIDTH ? VIEWWIDTH : ssXe;
+
+        // Setup stepping to avoid costly mult (and div) in critical loops
+        // These float divisions happen just once per sprite, hopefully that's not too bad.
+        // There used to be an option to set the precision of sprites but it didn't seem to make any difference
+        float stepXf = (float)TileSize / spriteWidth;
+        float stepYf = (float)TileSize / spriteHeight;
+
+        #ifdef RCSPRITEMIPMAPS
+        // Once a sprite is drawn at half size or less, every other texel is being skipped anyway, 
+        // so sample a smaller version instead. The step stays at 1 or more for the chosen level
+        if(TileSize != 16) {} // The mipmap sheets are 8x8 and 4x4, which only works for 16x16 sprites
+        else if(stepYf >= 4 && this->spritesheet4 && this->spritesheet_mask4)
+            result.mipmap = 2;
+        else if(stepYf >= 2 && this->spritesheet8 && this->spritesheet_mask8)
+            result.mipmap = 1;
+        stepXf /= (1 << result.mipmap);
+        stepYf /= (1 << result.mipmap);
+        #endif
+
+        result.texXInit = (result.drawStartX - ssX) * stepXf; // This unfortunately needs float because of precision glitches
+        result.texYInit = (result.drawStartY - ssY) * stepYf;
+        result.stepX = stepXf;
+        result.stepY = stepYf;
+        result.transformY = (uflot)transformYT;
+
+        #ifdef RCPRINTSPRITEDATA
+        //Clear a section for us to use
+        constexpr uint8_t sdh = 10;
+        arduboy->fillRect(0, HEIGHT - sdh, VIEWWIDTH, sdh, BLACK);
+        //Print some junk
+        tinyfont->setCursor(0, HEIGHT - sdh);
+        tinyfont->print((float)transformXT, 4);
+        tinyfont->print(" Y");
+        tinyfont->print(ssY);
+        tinyfont->setCursor(0, HEIGHT - sdh + 5);
+        tinyfont->print((float)transformYT, 4);
+        tinyfont->print(" W");
+        tinyfont->print(spriteWidth);
+        #endif
+
+        return result;
+    }
+
+
+    // Read a single sprite strip + its mask from the given sheets at the given mipmap level (see 
+    // RcSpriteDrawData). The mipmap sheets are never interleaved
+    static inline void readSpriteStrips(const uint8_t * sheet, const uint8_t * mask, uint8_t frame, uint8_t strip, uint8_t mipmap, TexStrip & data, TexStrip & dataMask)
+    {
+        #ifdef RCSPRITEMIPMAPS
+        if(mipmap == 1) 
+        {
+            data = readTextureStrip8(sheet, frame, strip);
+            dataMask = readTextureStrip8(mask, frame, strip);
+            return;
+        }
+        if(mipmap == 2) 
+        {
+            data = readTextureStrip4(sheet, frame, strip);
+            dataMask = readTextureStrip4(mask, frame, strip);
+            return;
+        }
+        #else
+        (void)mipmap;
+        #endif
+        Strips::readSprite(sheet, mask, frame, strip, data, dataMask);
+    }
+
+    //Draw the stripes of one projected sprite (see calcSpriteDraw) from the given sheets, skipping any
+    //stripe behind a wall. ShadeType compiles the sprite shading type into the loops (see drawSpriteKernel),
+    //otherwise it's read from this->spriteShading
+    template<uint8_t ShadeType = RCKERNELDYNAMIC>
+    void drawSpriteStripes(RcSpriteDrawData drawData, const uint8_t * spritesheet, const uint8_t * spritesheet_Mask, uint8_t fr, Arduboy2Base * arduboy)
+    {
+        uint8_t * sbuffer = arduboy->sBuffer;
+        uflot * distCache = this->_distCache;
+        uflot texX = drawData.texXInit;
+
+        uint8_t drawStartByte = drawData.drawStartY;
+        TOBYTECOUNT(drawStartByte); 
+        uint8_t drawEndByte = drawData.drawEndY;
+        TOBYTECOUNT(drawEndByte); 
+        TexStrip texData = 0;
+        TexStrip texMask = 0;
+
+        //uint8_t lastAccum;
+        uint8_t accumStart = drawData.texYInit.getFraction();
+        uint8_t accustep = drawData.stepY.getFraction();
+        uint8_t fullstep = drawData.stepY.getInteger();
+        uint8_t preshift = drawData.texYInit.getInteger();
+
+        uint8_t x = drawData.drawStartX;
+
+        // ------- BEGIN CRITICAL SECTION -------------
+        do //For every strip (x)
+        {
+            //If the sprite is hidden, skip this line. Lots of calculations bypassed!
+            if (drawData.transformY < distCache[x >> 1])
+            {
+                uint8_t tx = texX.getInteger();
+
+                readSpriteStrips(spritesheet, spritesheet_Mask, fr, tx, drawData.mipmap, texData, texMask);
+                texData >>= preshift;
+                texMask >>= preshift;
+
+                //A small optimization for small sprites
+                if(!texMask) goto SKIPSPRITESTRIPE;
+
+                RCSTAT(this->stats.spriteStripes++; this->stats.spritePixels += drawData.drawEndY - drawData.drawStartY;)
+
+                RcShadeInfo shading = this->calculateShading(drawData.transformY, x, this->spriteShading);
+                if(ShadeType != RCKERNELDYNAMIC)
+                    shading.type = (RcShadingType)ShadeType;
+                uint8_t shade = shading.shading;
+
+                //These five variables (including texData+texMask) are needed as part of the loop unrolling system
+                uint16_t bofs;
+                uint8_t texByte;
+                uint8_t maskByte;
+                uint8_t thisWallByte = drawStartByte;
+
+                uint8_t accum = accumStart;
+
+                //Pull screen byte, save location
+                #define _SPRITEREADSCRBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs]; maskByte = 0;
+                //Write previously read screen byte, go to next byte
+                #define _SPRITEWRITESCRNEXT() if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & (shade | ~maskByte)); } else { sbuffer[bofs] = (texByte | (shade & maskByte));} thisWallByte++;
+                //Work for setting bits of screen byte
+                #define _SPRITEBITUNROLL(bm,nbm) \
+                    if (texMask & 1) { if (texData & 1) texByte |= bm; else texByte &= nbm; maskByte |= bm; } \
+                    rcAccumulate(accum, accustep, texData, texMask); \
+                    if(fullstep) { texMask >>= fullstep; texData >>= fullstep; }
+
+                _SPRITEREADSCRBYTE();
+
+                #ifndef RCSMALLLOOPS
+
+                uint8_t yofs = drawData.drawStartY & 7;
+
+                //First and last bytes are tricky
+                if(yofs)
+                {
+                    uint8_t endFirst = min((drawStartByte + 1) * 8, drawData.drawEndY);
+                    uint8_t bm = fastlshift8(yofs);
+
+                    for (uint8_t i = drawData.drawStartY; i < endFirst; i++)
+                    {
+                        _SPRITEBITUNROLL(bm, (~bm));
+                        bm <<= 1;
+                    }
+
+                    //Move to next, like it never happened
+                    RCMASKTOP(shading, shade, yofs);
+                    _SPRITEWRITESCRNEXT();
+                    _SPRITEREADSCRBYTE();
+                    shade = shading.shading;
+                }
+
+                //Now the unrolled loop
+                while (thisWallByte < drawEndByte)
+                {
+                    _SPRITEBITUNROLL(0b00000001, 0b11111110);
+                    _SPRITEBITUNROLL(0b00000010, 0b11111101);
+                    _SPRITEBITUNROLL(0b00000100, 0b11111011);
+                    _SPRITEBITUNROLL(0b00001000, 0b11110111);
+                    _SPRITEBITUNROLL(0b00010000, 0b11101111);
+                    _SPRITEBITUNROLL(0b00100000, 0b11011111);
+                    _SPRITEBITUNROLL(0b01000000, 0b10111111);
+                    _SPRITEBITUNROLL(0b10000000, 0b01111111);
+                    _SPRITEWRITESCRNEXT();
+                    _SPRITEREADSCRBYTE();
+                }
+
+                yofs = drawData.drawEndY & 7;
+
+                //Last byte, but only need to do it if we end in the middle of a byte and don't simply span one byte
+                if(yofs && drawStartByte != drawEndByte)
+                {
+                    uint8_t endStart = thisWallByte * 8;
+                    uint8_t bm = fastlshift8(endStart & 7);
+                    for (uint8_t i = endStart; i < drawData.drawEndY; i++)
+                    {
+                        _SPRITEBITUNROLL(bm, (~bm));
+                        bm <<= 1;
+                    }
+
+                    //Only need to set the last byte if we're drawing in it of course
+                    RCMASKBOTTOM(shading, shade, yofs);
+                    _SPRITEWRITESCRNEXT();
+                }
+
+                #else // No loop unrolling
+
+                uint8_t y = drawData.drawStartY;
+
+                //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
+                if((drawData.drawStartY & 7) == 0) thisWallByte--;
+
+                do
+                {
+                    uint8_t bidx = y & 7;
+
+                    // Every new byte, save the current (previous) byte and load the new byte from the screen. 
+                    // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
+                    if(bidx == 0) {
+                        _SPRITEWRITESCRNEXT();
+                        _SPRITEREADSCRBYTE();
+                    }
+
+                    uint8_t bm = fastlshift8(bidx);
+                    _SPRITEBITUNROLL(bm, ~bm);
+                }
+                while(++y < drawData.drawEndY); //EXCLUSIVE
+
+                //The above loop specifically CAN'T reach the last byte, so although it's wasteful in the case of a 
+                //sprite ending at the bottom of the screen, it's still better than always incurring an if statement... maybe.
+                //if(drawData.drawEndY & 7)
+                _SPRITEWRITESCRNEXT();
+                //sbuffer[bofs] = texByte;
+
+                #endif
+
+            }
+
+            SKIPSPRITESTRIPE:
+            //This ONE step is why there has to be a big if statement up there. 
+            texX += drawData.stepX;
+        }
+        while(++x < drawData.drawEndX); //EXCLUSIVE
+        // ------- END CRITICAL SECTION -------------
+    }
+
+    #ifdef RCSPECIALIZEKERNELS
+    // Draw with the drawSpriteStripes instance for the sprite shading, see drawWallKernel
+    inline void drawSpriteKernel(RcSpriteDrawData drawData, const uint8_t * spritesheet, const uint8_t * spritesheet_Mask, uint8_t fr, Arduboy2Base * arduboy)
+    {
+        if(this->spriteShading == RcShadingType::White) drawSpriteStripes<RcShadingType::White>(drawData, spritesheet, spritesheet_Mask, fr, arduboy);
+        else drawSpriteStripes<RcShadingType::Black>(drawData, spritesheet, spritesheet_Mask, fr, arduboy);
+    }
+    #endif
+
+    template<uint8_t InternalStateBytes>
+    void drawSprites(RcPlayer * player, RcSpriteGroup<InternalStateBytes> * group, Arduboy2Base * arduboy)
+    {
+        RCPROFILESTART(t);
+        RcSpriteDrawPrecalc precalc = precalcSpriteDraw(player);
+        RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> culler = precalcSpriteCull(&precalc, player);
+        uint8_t usedSprites = group->sortSprites(player->posX, player->posY, &culler);
+        RCPROFILEMARK(t, RcProfilePhase::SpriteSort);
+
+        // Buffers, we pull them out like this just to make it a little easier (might remove later)
+        const uint8_t * spritesheet = this->spritesheet;
+        const uint8_t * spritesheet_Mask = this->spritesheet_mask;
+
+        // after sorting the sprites, do the projection and draw them. We know all sprites in the array are active,
+        // since we're looping against the sorted array.
+        for (uint8_t i = 0; i < usedSprites; i++)
+        {
+            //Get the current sprite so we don't have to dereference multiple pointers
+            RcSprite<InternalStateBytes> * sprite = group->sortedSprites[i].sprite;
+
+            RcSpriteDrawData drawData = calcSpriteDraw(&precalc, player, sprite);
+            RCPROFILEMARK(t, RcProfilePhase::SpriteProject);
+
+            // Skip drawing, it was determined nothing was needed
+            if(drawData.stepX == 0 && drawData.stepY == 0) continue;
+
+            RCSTAT(this->stats.spritesDrawn++;)
+
+            #ifdef RCSPRITEMIPMAPS
+            // Pick the sheets for this sprite's mipmap level
+            uint8_t mipmap = drawData.mipmap;
+            if(mipmap == 2)
+            {
+                spritesheet = this->spritesheet4;
+                spritesheet_Mask = this->spritesheet_mask4;
+            }
+            else if(mipmap == 1)
+            {
+                spritesheet = this->spritesheet8;
+                spritesheet_Mask = this->spritesheet_mask8;
+            }
+            else
+            {
+                spritesheet = this->spritesheet;
+                spritesheet_Mask = this->spritesheet_mask;
+            }
+            #endif
+
+            #ifdef RCSPECIALIZEKERNELS
+            drawSpriteKernel(drawData, spritesheet, spritesheet_Mask, sprite->frame, arduboy);
+            #else
+            drawSpriteStripes(drawData, spritesheet, spritesheet_Mask, sprite->frame, arduboy);
+            #endif
+
+            RCPROFILEMARK(t, RcProfilePhase::SpriteDraw);
+
+        }
+    }
+};
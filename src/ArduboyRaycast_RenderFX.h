@@ -1,748 +1,1377 @@
-#pragma once
-
-#include <FixedPoints.h>
-#include <Arduboy2.h>
-#include <ArduboyFX.h>
-
-#include "ArduboyRaycast_Utils.h"
-#include "ArduboyRaycast_Map.h"
-#include "ArduboyRaycast_Player.h"
-#include "ArduboyRaycast_SpriteGroup.h"
-#include "ArduboyRaycast_Shading.h"
-
-// Available flags for compilation
-// #define RCSMALLLOOPS           // The raycaster makes use of loop unrolling, which adds about 1.5kb code. This removes that but performance severely drops
-
-// Debug flags 
-// #define RCGENERALDEBUG       // Must be set for any of the othere to work
-// #define RCLINEHEIGHTDEBUG      // Display information about lineheight (only draws a few lines)
-// #define RCPRINTSPRITEDATA      // Display information about certain sprite-related properties
-
-#ifdef RCGENERALDEBUG
-#include <Tinyfont.h>
-#endif
-
-struct MipMapInfo {
-    uint8_t offset;
-    uint8_t width;
-    uint8_t bytes;
-};
-
-// -------------- CALCULATED / ASSUMED CONSTANTS, TRY NOT TO TOUCH ------------------------
-constexpr uint8_t BWIDTH = WIDTH >> 3;
-// Some assumptions (please try to follow these instead of changing them)
-constexpr uint8_t RCEMPTY = 0;
-constexpr uint8_t RCTILESIZE = 32;
-constexpr MipMapInfo MIPMAPS[8] PROGMEM = {
-    // Fields are:
-    // - Offsets into the TILE area to find the mipmap per "step" value.
-    // - The mipmap levels for each step value
-    // - The bytes per stripe for each step value
-    { 0, 32, 4 },
-    { 128, 16, 2 },
-    { 160, 8 , 1 },
-    { 160, 8 , 1 },
-    { 168, 4 , 1 },
-    { 168, 4 , 1 },
-    { 168, 4 , 1 },
-    { 168, 4 , 1 },
-};
-// ------------------------------------------------------------------------------
-
-uint8_t lastMipMap;
-MipMapInfo lastMipmapInfo;
-MipMapInfo get_mipmap_info(uint8_t mipmap) {
-    if(mipmap == lastMipMap) return lastMipmapInfo;
-    lastMipMap = mipmap;
-    memcpy_P(&lastMipmapInfo, MIPMAPS + mipmap, sizeof(MipMapInfo));
-    return lastMipmapInfo;
-}
-
-
-// A container for precalculated sprite information. These are calculations we
-// don't want to do per-frame
-struct RcSpriteDrawPrecalc
-{
-    float fposX;
-    float fposY;
-    float invDet;
-};
-
-// A container for calculated sprite draw data. You know a calculation was not performed
-// if stepX and stepY are 0
-struct RcSpriteDrawData
-{
-    uint8_t drawStartX;
-    uint8_t drawStartY;
-    uint8_t drawEndY;
-    uint8_t drawEndX;
-
-    MipMapInfo mminfo;
-
-    uflot texXInit;
-    uflot texYInit;
-    uflot stepX = 0;
-    uflot stepY = 0;
-
-    uflot transformY;
-};
-
-enum RcShadingType : uint8_t
-{
-    None,
-    Black,
-    White
-};
-
-struct RcShadeInfo
-{
-    uint8_t shading;
-    RcShadingType type;
-};
-
-#define RCMASKTOP(shading, shade, yofs) \
-    if(shading.type == RcShadingType::White) shade &= pgm_read_byte(shade_mask + yofs); \
-    else shade |= ~pgm_read_byte(shade_mask + yofs);
-#define RCMASKBOTTOM(shading, shade, yofs) \
-    if(shading.type == RcShadingType::White) shade &= ~pgm_read_byte(shade_mask + yofs); \
-    else shade |= pgm_read_byte(shade_mask + yofs);
-
-// Raycast renderer container, tracks data used for raycasting + lets you render raycasting
-template<uint8_t W, uint8_t H>
-class RcRender
-{
-public:
-    static constexpr uint8_t VIEWWIDTH = W;
-    static constexpr uint8_t VIEWHEIGHT = H;
-    static constexpr uint8_t VIEWHEIGHTBYTES = VIEWHEIGHT >> 3;
-    static constexpr uint8_t MIDSCREENY = VIEWHEIGHT / 2;
-    static constexpr uint8_t MIDSCREENX = VIEWWIDTH / 2;
-    static constexpr uflot INVWIDTH = 1.0 / VIEWWIDTH;
-    static constexpr float INVHEIGHT = 1.0 / VIEWHEIGHT;
-    static constexpr flot INVWIDTH2 = 2.0f / VIEWWIDTH;
-    static constexpr uint16_t MAXLHEIGHT = 32768;
-    static constexpr float MINLDISTANCE = 1.0f / MAXLHEIGHT;
-    static constexpr float MINSPRITEDISTANCE = 0.2;
-    static constexpr uflot SPRITEVIEWEXENTSION = 1;
-
-    uflot lightintensity = 1.0;     // Impacts view distance + shading even when no shading applied
-    uint24_t tilesheet;
-    uint24_t spritesheet;
-    uint24_t spritesheet_mask;
-    muflot spritescaling[4] = { 1.5, 1.0, 0.5, 0.25 };
-
-    uint8_t cornershading = 1;
-    RcShadingType shading = RcShadingType::Black;
-    RcShadingType altWallShading = RcShadingType::Black;
-    RcShadingType spriteShading = RcShadingType::None; //Sprite shading is kinda weird
-
-    // I want these to be private but they're needed elsewhere
-    uflot _viewdistance = 4.0;      // Calculated value
-    uflot _darkness = 1.0;          // Calculated value
-    uflot _distCache[VIEWWIDTH / 2]; // Half distance resolution means sprites will clip 1 pixel into walls sometimes but otherwise...
-
-    #ifdef RCGENERALDEBUG
-    Tinyfont * tinyfont;
-    #endif
-
-    // Clear the area represented by this raycaster
-    inline void clearRaycast(Arduboy2Base * arduboy)
-    {
-        fastClear(arduboy, 0, 0, VIEWWIDTH, VIEWHEIGHT);
-    }
-
-    // Draw a fast(?) raycast background, assumed to start at 0,0. Your background should
-    // NOT have the usual width/height. Will underdraw in the Y direction if VIEWHEIGHT not 
-    // a multiple of 8
-    inline void drawRaycastBackground(Arduboy2Base * arduboy, const uint8_t * bg)
-    {
-        for(uint8_t i = 0; i < VIEWHEIGHTBYTES; ++i)
-            memcpy_P(arduboy->sBuffer + i * WIDTH, bg + i * VIEWWIDTH, VIEWWIDTH);
-    }
-
-    // Calculate the appropriate shading for this wall slice given our rendering config
-    inline RcShadeInfo calculateShading(uflot distance, uint8_t x, RcShadingType shading)
-    {
-        if(shading == RcShadingType::None)
-        {
-            return RcShadeInfo {
-                0xFF,
-                RcShadingType::Black
-            };
-        }
-        else
-        {
-            RcShadeInfo result {
-                calcShading(distance, x, this->_darkness),
-                shading
-            };
-            if(shading == RcShadingType::White)
-                result.shading = ~result.shading;
-            return result;
-        }
-    }
-
-    // Set the light intensity for raycasting. Performs several expensive calculations, only set this
-    // when necessary
-    void setLightIntensity(uflot intensity)
-    {
-        // Skip complicated calcs
-        if(intensity == this->lightintensity)
-            return;
-
-        this->lightintensity = intensity;
-        this->_viewdistance = sqrt(BAYERGRADIENTS * (float)intensity);
-        this->_darkness = 1 / intensity;
-    }
-
-    // The full function for raycasting. 
-    void raycastWalls(RcPlayer * p, RcMap * map, Arduboy2Base * arduboy)
-    {
-        uint8_t pmapX = p->posX.getInteger();
-        uint8_t pmapY = p->posY.getInteger();
-        uint8_t startMapIndex = map->getIndex(pmapX, pmapY);
-        uflot pmapofsX = p->posX - pmapX;
-        uflot pmapofsY = p->posY - pmapY;
-        flot fposX = (flot)p->posX, fposY = (flot)p->posY;
-        flot dX = p->dirX, dY = p->dirY;
-        uflot viewdistance = this->_viewdistance;
-        uflot * distCache = this->_distCache;
-
-        for (uint8_t x = 0; x < VIEWWIDTH; x++)
-        {
-            flot cameraX = x * INVWIDTH2 - 1; // x-coordinate in camera space
-
-            // The camera plane is a simple -90 degree rotation on the player direction (as required for this algorithm).
-            flot rayDirX = dX + dY * cameraX;
-            flot rayDirY = dY - dX * cameraX;
-
-            // length of ray from one x or y-side to next x or y-side. But we prefill it with
-            // some initial data which has to be massaged later.
-            uflot deltaDistX = (uflot)abs(rayDirX); //Temp value; may not be used
-            uflot deltaDistY = (uflot)abs(rayDirY); //same
-
-            // length of ray from current position to next x or y-side
-            uflot sideDistX = MAXFIXED;
-            uflot sideDistY = MAXFIXED;
-
-            // what direction to step in x or y-direction (either +1 or -1)
-            int8_t stepX = 0;
-            int8_t stepY = 0;
-
-            // With this DDA stepping algorithm, have to be careful about making too-large values
-            // with our tiny fixed point numbers. Make some arbitrarily small cutoff point for
-            // even trying to deal with steps in that direction. As long as the map size is 
-            // never larger than 1 / NEARZEROFIXED on any side, it will be fine (that means
-            // map has to be < 100 on a side with this)
-            if(deltaDistX > NEARZEROFIXED) {
-                deltaDistX = uReciprocalNearUnit(deltaDistX); 
-                if (rayDirX < 0) {
-                    stepX = -1;
-                    sideDistX = pmapofsX * deltaDistX;
-                }
-                else {
-                    stepX = 1;
-                    sideDistX = (1 - pmapofsX) * deltaDistX;
-                }
-            }
-            if(deltaDistY > NEARZEROFIXED) {
-                deltaDistY = uReciprocalNearUnit(deltaDistY); 
-                if (rayDirY < 0) {
-                    stepY = -map->width;
-                    sideDistY = pmapofsY * deltaDistY;
-                }
-                else {
-                    stepY = map->width;
-                    sideDistY = (1 - pmapofsY) * deltaDistY;
-                }
-            }
-
-            uint8_t side;           // was a NS or a EW wall hit?
-            uint8_t mapIndex = startMapIndex;
-            uflot perpWallDist = 0;   // perpendicular distance (not real distance)
-            uint8_t tile;
-
-            // perform DDA. A do/while loop is ever-so-slightly faster it seems?
-            do
-            {
-                // jump to next map square, either in x-direction, or in y-direction
-                if (sideDistX < sideDistY) {
-                    perpWallDist = sideDistX; // Remember that sideDist is actual distance and not distance only in 1 direction
-                    sideDistX += deltaDistX;
-                    mapIndex += stepX;
-                    side = 0; //0 = xside hit
-                }
-                else {
-                    perpWallDist = sideDistY;
-                    sideDistY += deltaDistY;
-                    mapIndex += stepY;
-                    side = 1; //1 = yside hit
-                }
-                tile = map->map[mapIndex];
-            }
-            while (perpWallDist < viewdistance && tile == RCEMPTY);
-
-            //Only calc distance for every other point to save a lot of memory (100 bytes)
-            if((x & 1) == 0)
-                distCache[x >> 1] = perpWallDist;
-
-            // If the above loop was exited without finding a tile, there's nothing to draw
-            if(tile == RCEMPTY) continue;
-
-            // Figure out NOW what the line height and mipmap level is is. Note: I've tried many types for this
-            // invLineHeight, since it's used so much, but float actually seems to work best...
-            float invLineHeight = INVHEIGHT * (float)perpWallDist; 
-            uint8_t mipmap = RCTILESIZE * invLineHeight;
-            if(mipmap > 7) return;
-            MipMapInfo mminfo = get_mipmap_info(mipmap);
-
-            //NOTE: wallX technically can only be positive, but I'm using flot to save a tiny amount from casting
-            flot wallX = side ? fposX + (flot)perpWallDist * rayDirX : fposY + (flot)perpWallDist * rayDirY;
-            uint8_t texX = uint8_t((wallX - floorFixed(wallX)) * mminfo.width); //.getFraction isn't what you think!
-            if((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = mminfo.width - 1 - texX;
-
-            UFixed<16,16> step = mminfo.width * invLineHeight;
-            uint16_t lineHeight = (invLineHeight <= MINLDISTANCE) ? MAXLHEIGHT : (uint16_t)(1 / invLineHeight);
-            uint32_t texData;
-
-            if((side & x) && this->altWallShading != RcShadingType::None)
-                texData = this->altWallShading == RcShadingType::Black ? 0x0 : 0xFFFFFFFF;
-            else
-                FX::readDataObject<uint32_t>(this->tilesheet + tile * 172 + mminfo.offset + texX * mminfo.bytes, texData);
-
-            #ifdef RCLINEHEIGHTDEBUG
-            tinyfont.setCursor(16, x * 16);
-            tinyfont.println(lineHeight);
-            tinyfont.setCursor(16, x * 16 + 8);
-            tinyfont.println((float)perpWallDist);
-            if(x > 2) break;
-            #endif
-
-            //ending should be exclusive
-            drawWallLine(x, lineHeight, step, calculateShading(perpWallDist, x, this->shading), texData, arduboy);
-        }
-    }
-
-    //Draw a single raycast wall line. Will only draw specifically the wall line and will clip out all the rest
-    //(so you can predraw a ceiling and floor before calling raycast)
-    //void drawWallLine(uint8_t x, uflot distance, RcShadeInfo shading, uint16_t texData, Arduboy2Base * arduboy)
-    void drawWallLine(uint8_t x, uint16_t lineHeight, UFixed<16,16> step, RcShadeInfo shading, uint32_t texData, Arduboy2Base * arduboy)
-    {
-        // ------- BEGIN CRITICAL SECTION -------------
-        int16_t halfLine = lineHeight >> 1;
-        uint8_t yStart = max(0, MIDSCREENY - halfLine);
-        uint8_t yEnd = min(VIEWHEIGHT, MIDSCREENY + halfLine); //EXCLUSIVE
-
-        //Everyone prefers the high precision tiles (and for some reason, it's now faster? so confusing...)
-        UFixed<16,16> texPos = (yStart + halfLine - MIDSCREENY) * step;
-
-        //These four variables are needed as part of the loop unrolling system
-        uint16_t bofs;
-        uint8_t texByte;
-        uint8_t thisWallByte = yStart;
-        TOBYTECOUNT(thisWallByte);
-        uint8_t * sbuffer = arduboy->sBuffer;
-        uint8_t shade = shading.shading;
-
-        uint8_t accustep = (step.getFraction() >> 8);
-        uint8_t accum = (texPos.getFraction() >> 8);
-        texData >>= texPos.getInteger();
-
-        //Pull wall byte, save location
-        #define _WALLREADBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs];
-        //Write previously read wall byte, go to next byte
-        #define _WALLWRITENEXT(mixin) if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & shade) mixin; } else { sbuffer[bofs] = (texByte | shade) mixin;} thisWallByte++;
-        //Work for setting bits of wall byte. Use an imperfect overflow accumulator to approximate stepping through texture.
-        #define _WALLBITUNROLL(bm,nbm) \
-            if(texData & 1) texByte |= (bm); \
-            else texByte &= (nbm); \
-            accum += accustep; \
-            if (accum < accustep) { texData >>= 1; }
-
-        _WALLREADBYTE();
-
-        #ifndef RCSMALLLOOPS
-
-        uint8_t startByte = thisWallByte; //The byte within which we start, always inclusive
-        uint8_t endByte = yEnd;
-        TOBYTECOUNT(endByte);
-
-        uint8_t yofs = yStart & 7;
-
-        //First and last bytes are tricky
-        if(yofs)
-        {
-            uint8_t endFirst = min((startByte + 1) * 8, yEnd);
-            uint8_t bm = fastlshift8(yofs);
-
-            for (uint8_t i = yStart; i < endFirst; i++) {
-                _WALLBITUNROLL(bm, (~bm));
-                bm <<= 1;
-            }
-
-            //Move to next, like it never happened (but mask shading)
-            RCMASKTOP(shading, shade, yofs);
-            _WALLWRITENEXT();
-            _WALLREADBYTE();
-            shade = shading.shading;
-        }
-
-        // Now the unrolled loop
-        while (thisWallByte < endByte)
-        {
-            _WALLBITUNROLL(0b00000001, 0b11111110);
-            _WALLBITUNROLL(0b00000010, 0b11111101);
-            _WALLBITUNROLL(0b00000100, 0b11111011);
-            _WALLBITUNROLL(0b00001000, 0b11110111);
-            _WALLBITUNROLL(0b00010000, 0b11101111);
-            _WALLBITUNROLL(0b00100000, 0b11011111);
-            _WALLBITUNROLL(0b01000000, 0b10111111);
-            _WALLBITUNROLL(0b10000000, 0b01111111);
-            _WALLWRITENEXT();
-            _WALLREADBYTE();
-        }
-
-        yofs = yEnd & 7;
-        //Last byte, but only need to do it if we don't simply span one byte
-        if(yofs && startByte != endByte)
-        {
-            uint8_t bm = 1;
-            for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
-                _WALLBITUNROLL(bm, (~bm));
-                bm <<= 1;
-            }
-
-            //"Don't repeat yourself": that ship has sailed. Anyway, only write the last byte if we need to, otherwise
-            //we could legitimately write outside the bounds of the screen.
-            RCMASKBOTTOM(shading, shade, yofs);
-            if(cornershading) { _WALLWRITENEXT(& ~(fastlshift8(yofs))); }
-            else { _WALLWRITENEXT(); }
-        }
-
-        #else // No loop unrolling
-
-        //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
-        if((yStart & 7) == 0) thisWallByte--;
-        uint8_t bm = fastlshift8(yStart & 7);
-
-        do
-        {
-            uint8_t bidx = yStart & 7;
-
-            // Every new byte, save the current (previous) byte and load the new byte from the screen. 
-            // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
-            if(bidx == 0) {
-                bm = 1;
-                _WALLWRITENEXT();
-                _WALLREADBYTE();
-            }
-
-            _WALLBITUNROLL(bm, ~bm);
-            bm <<= 1;
-        }
-        while(++yStart < yEnd);
-
-        if(cornershading && yEnd != VIEWHEIGHT) { _WALLWRITENEXT(& ~(fastlshift8(yEnd & 7))); }
-        else { _WALLWRITENEXT(); }
-
-        #endif
-
-        // ------- END CRITICAL SECTION -------------
-    }
-
-
-    //Precalculate some sprite drawing stuff, happens before any loop, not tied to a sprite
-    RcSpriteDrawPrecalc precalcSpriteDraw(RcPlayer * player)
-    {
-        RcSpriteDrawPrecalc result;
-
-        result.fposX = (float)player->posX;
-        result.fposY = (float)player->posY;
-        result.invDet = 1.0 / (player->dirY * player->dirY + player->dirX * player->dirX); // required for correct matrix multiplication
-
-        return result;
-    }
-
-    template<uint8_t InternalStateBytes>
-    RcSpriteDrawData calcSpriteDraw(RcSpriteDrawPrecalc * calc, RcPlayer * player, RcSprite<InternalStateBytes> * sprite)
-    {
-        RcSpriteDrawData result;
-
-        float spriteX = (float)sprite->x - calc->fposX;
-        float spriteY = (float)sprite->y - calc->fposY;
-
-        float transformYT = calc->invDet * (player->dirX * spriteX + player->dirY * spriteY); // this is actually the depth inside the screen, that what Z is in 3D
-
-        // Nice quick shortcut to get out for sprites behind us (and ones that are too close / far)
-        if (transformYT < MINSPRITEDISTANCE ) //|| transformYT > _viewdistance + SPRITEVIEWEXENTSION) //_sviewdistance)
-            return result;
-
-        float invTransformYT = 1 / transformYT;
-        float transformXT = calc->invDet * (player->dirY * spriteX - player->dirX * spriteY);
-
-        // int16 because easy overflow! if x is much larger than y, then you're effectively multiplying 50 by map width.
-        //  NOTE: this is the CENTER of the sprite, not the edge (thankfully)
-        int16_t spriteScreenX = int16_t(MIDSCREENX * (1 + transformXT * invTransformYT));
-
-        // calculate the dimensions of the sprite on screen. All sprites are square. Size mods go here
-        // using 'transformY' instead of the real distance prevents fisheye
-        float scale = (float)this->spritescaling[(sprite->state & RSSTATESIZE) >> 1];
-        uint16_t spriteHeight = uint16_t(VIEWHEIGHT * invTransformYT * scale);
-        uint16_t spriteWidth = spriteHeight;
-
-        // calculate lowest and highest pixel to fill. Sprite screen/start X and Sprite screen/start Y
-        // Because we have 1 fewer bit to store things, we unfortunately need an int16
-        int16_t ssX = -(spriteWidth >> 1) + spriteScreenX; // Offsets go here, but modified by distance or something?
-        int16_t ssXe = ssX + spriteWidth;                  // EXCLUSIVE
-
-        // Get out if sprite is completely outside view
-        if (ssXe < 0 || ssX > VIEWWIDTH)
-            return result;
-
-        // Calculate vertical shift from top 5 bits of state
-        uint8_t yShiftBits = sprite->state;
-        TOBYTECOUNT(yShiftBits); //((sprite->state >> 1) >> 1) >> 1;
-        int16_t yShift = yShiftBits ? int16_t((yShiftBits & 16 ? -(yShiftBits & 15) : (yShiftBits & 15)) * max(scale, 1.0) * 2.0 * invTransformYT) : 0;
-        // The above didn't work without float math, didn't feel like figuring out the ridiculous type casting
-
-        int16_t ssY = -(spriteHeight >> 1) + MIDSCREENY + yShift;
-        int16_t ssYe = ssY + spriteHeight; // EXCLUSIVE
-
-        if (ssYe < 0 || ssY > VIEWHEIGHT)
-            return result;
-
-        float invHeight = 1.0 / spriteHeight;
-        uint8_t mipmap = RCTILESIZE * invHeight;
-        if(mipmap > 7) return;
-        result.mminfo = get_mipmap_info(mipmap);
-
-        result.drawStartY = ssY < 0 ? 0 : ssY; // Because of these checks, we can store them in 1 byte stuctures
-        result.drawEndY = ssYe > VIEWHEIGHT ? VIEWHEIGHT : ssYe;
-        result.drawStartX = ssX < 0 ? 0 : ssX;
-        result.drawEndX = ssXe > VIEWWIDTH ? VIEWWIDTH : ssXe;
-
-        // Setup stepping to avoid costly mult (and div) in critical loops
-        // These float divisions happen just once per sprite, hopefully that's not too bad.
-        // There used to be an option to set the precision of sprites but it didn't seem to make any difference
-        float stepXf = (float)result.mminfo.width / spriteWidth;
-        float stepYf = result.mminfo.width * invHeight;
-
-        result.texXInit = (result.drawStartX - ssX) * stepXf; // This unfortunately needs float because of precision glitches
-        result.texYInit = (result.drawStartY - ssY) * stepYf;
-        result.stepX = stepXf;
-        result.stepY = stepYf;
-        result.transformY = (uflot)transformYT;
-
-        #ifdef RCPRINTSPRITEDATA
-        //Clear a section for us to use
-        constexpr uint8_t sdh = 10;
-        arduboy->fillRect(0, HEIGHT - sdh, VIEWWIDTH, sdh, BLACK);
-        //Print some junk
-        tinyfont->setCursor(0, HEIGHT - sdh);
-        tinyfont->print((float)transformXT, 4);
-        tinyfont->print(" Y");
-        tinyfont->print(ssY);
-        tinyfont->setCursor(0, HEIGHT - sdh + 5);
-        tinyfont->print((float)transformYT, 4);
-        tinyfont->print(" W");
-        tinyfont->print(spriteWidth);
-        #endif
-
-        return result;
-    }
-
-
-    template<uint8_t InternalStateBytes>
-    void drawSprites(RcPlayer * player, RcSpriteGroup<InternalStateBytes> * group, Arduboy2Base * arduboy)
-    {
-        uint8_t usedSprites = group->sortSprites(player->posX, player->posY);
-
-        // Buffers, we pull them out like this just to make it a little easier (might remove later)
-        const uint24_t spritesheet = this->spritesheet;
-        const uint24_t spritesheet_Mask = this->spritesheet_mask;
-        uint8_t * sbuffer = arduboy->sBuffer;
-        uflot * distCache = this->_distCache;
-
-        RcSpriteDrawPrecalc precalc = precalcSpriteDraw(player);
-
-        // after sorting the sprites, do the projection and draw them. We know all sprites in the array are active,
-        // since we're looping against the sorted array.
-        for (uint8_t i = 0; i < usedSprites; i++)
-        {
-            //Get the current sprite so we don't have to dereference multiple pointers
-            RcSprite<InternalStateBytes> * sprite = group->sortedSprites[i].sprite;
-
-            RcSpriteDrawData drawData = calcSpriteDraw(&precalc, player, sprite);
-
-            // Skip drawing, it was determined nothing was needed
-            if(drawData.stepX == 0 && drawData.stepY == 0) continue;
-
-            uflot texX = drawData.texXInit;
-            uint8_t fr = sprite->frame;
-
-            uint8_t drawStartByte = drawData.drawStartY;
-            TOBYTECOUNT(drawStartByte); 
-            uint8_t drawEndByte = drawData.drawEndY;
-            TOBYTECOUNT(drawEndByte); 
-            uint32_t texData = 0;
-            uint32_t texMask = 0;
-
-            uint8_t accumStart = drawData.texYInit.getFraction();
-            uint8_t accustep = drawData.stepY.getFraction();
-            uint8_t preshift = drawData.texYInit.getInteger();
-
-            uint8_t x = drawData.drawStartX;
-
-            // ------- BEGIN CRITICAL SECTION -------------
-            do //For every strip (x)
-            {
-                //If the sprite is hidden, skip this line. Lots of calculations bypassed!
-                if (drawData.transformY < distCache[x >> 1])
-                {
-                    uint8_t tx = texX.getInteger();
-
-                    FX::readDataObject<uint32_t>(spritesheet + fr * 172 + tx * drawData.mminfo.bytes + drawData.mminfo.offset, texData);
-                    FX::readDataObject<uint32_t>(spritesheet_Mask + fr * 172 + tx * drawData.mminfo.bytes + drawData.mminfo.offset, texMask);
-                    //texMask = 0xFFFFFFFF;
-                    texData >>= preshift;
-                    texMask >>= preshift;
-
-                    //A small optimization for small sprites
-                    if(!texMask) goto SKIPSPRITESTRIPE;
-
-                    RcShadeInfo shading = this->calculateShading(drawData.transformY, x, this->spriteShading);
-                    uint8_t shade = shading.shading;
-
-                    //These five variables (including texData+texMask) are needed as part of the loop unrolling system
-                    uint16_t bofs;
-                    uint8_t texByte;
-                    uint8_t maskByte;
-                    uint8_t thisWallByte = drawStartByte;
-
-                    uint8_t accum = accumStart;
-
-                    //Pull screen byte, save location
-                    #define _SPRITEREADSCRBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs]; maskByte = 0;
-                    //Write previously read screen byte, go to next byte
-                    #define _SPRITEWRITESCRNEXT() if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & (shade | ~maskByte)); } else { sbuffer[bofs] = (texByte | (shade & maskByte));} thisWallByte++;
-                    //Work for setting bits of screen byte
-                    #define _SPRITEBITUNROLL(bm,nbm) \
-                        if (texMask & 1) { if (texData & 1) texByte |= bm; else texByte &= nbm; maskByte |= bm; } \
-                        accum += accustep; \
-                        if (accum < accustep) { texData >>= 1; texMask >>= 1; }
-
-                        // asm volatile( \
-                        //     "add %[accum], %[step]    \n" \
-                        //     "brcc .+8       \n" \
-                        //     "lsr %B[td]     \n" \
-                        //     "ror %A[td]     \n" \
-                        //     "lsr %B[td2]     \n" \
-                        //     "ror %A[td2]     \n" \
-                        //     : [accum] "+&r" (accum), \
-                        //       [td] "+&r" (texData),  \
-                        //       [td2] "+&r" (texMask)  \
-                        //     : [step] "r" (accustep) \
-                        // ); \
-                        //if(fullstep) { texMask >>= fullstep; texData >>= fullstep; }
-
-                    _SPRITEREADSCRBYTE();
-
-                    #ifndef RCSMALLLOOPS
-
-                    uint8_t yofs = drawData.drawStartY & 7;
-
-                    //First and last bytes are tricky
-                    if(yofs)
-                    {
-                        uint8_t endFirst = min((drawStartByte + 1) * 8, drawData.drawEndY);
-                        uint8_t bm = fastlshift8(yofs);
-
-                        for (uint8_t i = drawData.drawStartY; i < endFirst; i++)
-                        {
-                            _SPRITEBITUNROLL(bm, (~bm));
-                            bm <<= 1;
-                        }
-
-                        //Move to next, like it never happened
-                        RCMASKTOP(shading, shade, yofs);
-                        _SPRITEWRITESCRNEXT();
-                        _SPRITEREADSCRBYTE();
-                        shade = shading.shading;
-                    }
-
-                    //Now the unrolled loop
-                    while (thisWallByte < drawEndByte)
-                    {
-                        _SPRITEBITUNROLL(0b00000001, 0b11111110);
-                        _SPRITEBITUNROLL(0b00000010, 0b11111101);
-                        _SPRITEBITUNROLL(0b00000100, 0b11111011);
-                        _SPRITEBITUNROLL(0b00001000, 0b11110111);
-                        _SPRITEBITUNROLL(0b00010000, 0b11101111);
-                        _SPRITEBITUNROLL(0b00100000, 0b11011111);
-                        _SPRITEBITUNROLL(0b01000000, 0b10111111);
-                        _SPRITEBITUNROLL(0b10000000, 0b01111111);
-                        _SPRITEWRITESCRNEXT();
-                        _SPRITEREADSCRBYTE();
-                    }
-
-                    yofs = drawData.drawEndY & 7;
-
-                    //Last byte, but only need to do it if we end in the middle of a byte and don't simply span one byte
-                    if(yofs && drawStartByte != drawEndByte)
-                    {
-                        uint8_t endStart = thisWallByte * 8;
-                        uint8_t bm = fastlshift8(endStart & 7);
-                        for (uint8_t i = endStart; i < drawData.drawEndY; i++)
-                        {
-                            _SPRITEBITUNROLL(bm, (~bm));
-                            bm <<= 1;
-                        }
-
-                        //Only need to set the last byte if we're drawing in it of course
-                        RCMASKBOTTOM(shading, shade, yofs);
-                        _SPRITEWRITESCRNEXT();
-                    }
-
-                    #else // No loop unrolling
-
-                    uint8_t y = drawData.drawStartY;
-
-                    //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
-                    if((drawData.drawStartY & 7) == 0) thisWallByte--;
-
-                    do
-                    {
-                        uint8_t bidx = y & 7;
-
-                        // Every new byte, save the current (previous) byte and load the new byte from the screen. 
-                        // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
-                        if(bidx == 0) {
-                            _SPRITEWRITESCRNEXT();
-                            _SPRITEREADSCRBYTE();
-                        }
-
-                        uint8_t bm = fastlshift8(bidx);
-                        _SPRITEBITUNROLL(bm, ~bm);
-                    }
-                    while(++y < drawData.drawEndY); //EXCLUSIVE
-
-                    //The above loop specifically CAN'T reach the last byte, so although it's wasteful in the case of a 
-                    //sprite ending at the bottom of the screen, it's still better than always incurring an if statement... maybe.
-                    //if(drawData.drawEndY & 7)
-                    _SPRITEWRITESCRNEXT();
-                    //sbuffer[bofs] = texByte;
-
-                    #endif
-
-                }
-
-                SKIPSPRITESTRIPE:
-                //This ONE step is why there has to be a big if statement up there. 
-                texX += drawData.stepX;
-            }
-            while(++x < drawData.drawEndX); //EXCLUSIVE
-            // ------- END CRITICAL SECTION -------------
-
-        }
-    }
-};
+#pragma once
+
+#include <FixedPoints.h>
+#include <Arduboy2.h>
+#include <ArduboyFX.h>
+
+#include "ArduboyRaycast_Utils.h"
+#include "ArduboyRaycast_Map.h"
+#include "ArduboyRaycast_MapPager.h"
+#include "ArduboyRaycast_Player.h"
+#include "ArduboyRaycast_SpriteGroup.h"
+#include "ArduboyRaycast_Shading.h"
+#include "ArduboyRaycast_Profile.h"
+#include "ArduboyRaycast_RayCache.h"
+
+// Available flags for compilation
+// #define RCSMALLLOOPS           // The raycaster makes use of loop unrolling, which adds about 1.5kb code. This removes that but performance severely drops
+// #define RCLARGEMAP             // 16 bit map indices, for maps larger than 16x16. Slightly slower DDA
+// #define RCCACHERAYS            // Keep per-column ray directions in RAM, only recalculated when the player turns. Uses 8 bytes per column!
+// #define RCRENDERSTATS          // Count per-frame rendering work into render.stats (see ArduboyRaycast_Profile.h). Costs RAM + speed, benchmarking only
+// #define RCPROFILE              // Time each rendering phase into render.profiler (see ArduboyRaycast_Profile.h). Costs RAM + speed
+// #define RCSHADINGTABLE         // Look distance shading up in a RAM table (rebuilt by setLightIntensity) instead of calculating it per column + stripe. Distance steps are slightly coarser
+// #define RCSHADINGTABLESIZE 64  // Entries in the shading table, 1 byte each
+// #define RCFXPIPELINE           // Start reading the next texture strip from the FX chip before drawing the current one, so the transfer overlaps drawing
+// #define RCFXSORTEDFETCH        // Gather wall columns in batches and read their textures in flash address order, mostly as one continuous read. Overrides RCFXPIPELINE for walls
+// #define RCFXBATCH 16           // How many columns RCFXSORTEDFETCH gathers before reading + drawing them. Stack is about 18 bytes per column
+// #define RCFXCACHE              // Keep recently read texture strips in RAM so repeated strips skip the FX chip (see RcFxStripCache)
+// #define RCFXCACHEENTRIES 16    // How many strips the cache holds. Must be a power of 2. RAM is 8 bytes per entry
+// #define RCFXINTERLEAVEDSPRITES // Sprite data + mask are interleaved per stripe in one sheet (see "Interleaved sprites" in the readme), so each stripe is one FX read instead of two. spritesheet_mask is unused
+// #define RCSPECIALIZEKERNELS    // Compile the wall + sprite drawing loops for black and for white shading, picked per column / sprite instead of checked per byte. Measured no faster in bench_fx on PC, where the FX reads are free, for about a fifth more renderer progmem; not yet timed on AVR
+
+// Debug flags 
+// #define RCGENERALDEBUG       // Must be set for any of the othere to work
+// #define RCLINEHEIGHTDEBUG      // Display information about lineheight (only draws a few lines)
+// #define RCPRINTSPRITEDATA      // Display information about certain sprite-related properties
+
+#ifdef RCGENERALDEBUG
+#include <Tinyfont.h>
+#endif
+
+struct MipMapInfo {
+    uint8_t offset;
+    uint8_t width;
+    uint8_t bytes;
+};
+
+// -------------- CALCULATED / ASSUMED CONSTANTS, TRY NOT TO TOUCH ------------------------
+constexpr uint8_t BWIDTH = WIDTH >> 3;
+// Some assumptions (please try to follow these instead of changing them)
+constexpr uint8_t RCEMPTY = 0;
+constexpr uint8_t RCTILESIZE = 32;  // Tile size of the default layout (RcFxLayout32)
+
+// Mipmap tables, one entry per "step" value (tile size / line height, so how many texels each 
+// screen pixel covers). Fields are:
+// - Offsets into the TILE area to find the mipmap per "step" value.
+// - The mipmap levels for each step value
+// - The bytes per stripe for each step value
+constexpr MipMapInfo RCMIPMAPS32[8] PROGMEM = {
+    { 0, 32, 4 },
+    { 128, 16, 2 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+    { 168, 4 , 1 },
+    { 168, 4 , 1 },
+    { 168, 4 , 1 },
+    { 168, 4 , 1 },
+};
+constexpr MipMapInfo RCMIPMAPS32NO4[8] PROGMEM = {
+    { 0, 32, 4 },
+    { 128, 16, 2 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+    { 160, 8 , 1 },
+};
+constexpr MipMapInfo RCMIPMAPS16[4] PROGMEM = {
+    { 0, 16, 2 },
+    { 32, 8 , 1 },
+    { 40, 4 , 1 },
+    { 40, 4 , 1 },
+};
+// ------------------------------------------------------------------------------
+
+// Layouts describe how tiles and sprite frames are stored in the FX data, and are passed to 
+// RcRender / RcContainer as a template parameter. They MUST match what generated your fxdata:
+// - TILESIZE: the base (largest) tile and sprite size
+// - FRAMEBYTES: bytes per tile or sprite frame, which is all mipmap levels (largest first) back to back
+// - MIPSTEPS: entries in the mipmap table. Anything needing a larger step isn't drawn (too far away)
+// - mipmaps(): the mipmap table in progmem (see above)
+// You can make your own as long as it has the same members and no level is wider than 32.
+
+// 32x32 base with 16x16, 8x8 and 4x4 mipmaps. This is the original (and default) layout
+struct RcFxLayout32
+{
+    static constexpr uint8_t TILESIZE = 32;
+    static constexpr uint16_t FRAMEBYTES = 172;
+    static constexpr uint8_t MIPSTEPS = 8;
+    static inline const MipMapInfo * mipmaps() { return RCMIPMAPS32; }
+};
+
+// 32x32 base with 16x16 and 8x8 mipmaps, the 8x8 level is used for everything further away
+struct RcFxLayout32No4
+{
+    static constexpr uint8_t TILESIZE = 32;
+    static constexpr uint16_t FRAMEBYTES = 168;
+    static constexpr uint8_t MIPSTEPS = 8;
+    static inline const MipMapInfo * mipmaps() { return RCMIPMAPS32NO4; }
+};
+
+// 16x16 base with 8x8 and 4x4 mipmaps. Each strip is at most 2 bytes and frames are a quarter of 
+// the size, so reads are cheaper and the fxdata much smaller
+struct RcFxLayout16
+{
+    static constexpr uint8_t TILESIZE = 16;
+    static constexpr uint16_t FRAMEBYTES = 44;
+    static constexpr uint8_t MIPSTEPS = 4;
+    static inline const MipMapInfo * mipmaps() { return RCMIPMAPS16; }
+};
+
+template<typename Layout>
+MipMapInfo get_mipmap_info(uint8_t mipmap) {
+    static uint8_t lastMipMap = 0xFF;
+    static MipMapInfo lastMipmapInfo;
+    if(mipmap == lastMipMap) return lastMipmapInfo;
+    lastMipMap = mipmap;
+    memcpy_P(&lastMipmapInfo, Layout::mipmaps() + mipmap, sizeof(MipMapInfo));
+    return lastMipmapInfo;
+}
+
+// Read bytes sequentially out of FX flash, for loading run-length encoded maps stored in fxdata
+// (see decodeRleMap). Maps are only loaded occasionally, so this just reads one byte at a time
+struct RcFxReader
+{
+    uint24_t address;
+
+    inline uint8_t next()
+    {
+        uint8_t result;
+        FX::readDataObject<uint8_t>(this->address++, result);
+        return result;
+    }
+};
+
+// A world map stored in FX flash as one byte per tile, row by row. Used with RcMapPager
+struct RcFxMapSource
+{
+    uint24_t address;
+    uint16_t width;
+
+    inline void read(uint16_t x, uint16_t y, uint8_t * dest, uint8_t length)
+    {
+        FX::readDataBytes(this->address + (uint24_t)y * this->width + x, dest, length);
+    }
+};
+
+#ifndef RCFXCACHEENTRIES
+#define RCFXCACHEENTRIES 16
+#endif
+
+#ifndef RCFXBATCH
+#define RCFXBATCH 16
+#endif
+
+// Used as the texture address of columns that don't need a texture read
+constexpr uint24_t RCFXNOREAD = 0xFFFFFF;
+// When reading in address order, gaps up to this many bytes are read through rather than starting 
+// a new read (each new read costs about as much as reading 4 bytes)
+constexpr uint8_t RCFXMAXSKIP = 4;
+
+// A small direct mapped cache of texture strips read from the FX chip. Strips are keyed by their 
+// final flash address, which already encodes the sheet, tile/frame, mipmap and texture column. 
+// Since neighbouring columns (especially far away) and sprite stripes very often read the same or 
+// neighbouring strips, a few entries catch most repeat reads. Cheap to check, but not free, so 
+// check the hit/miss counters to see if it's worth it for your game.
+class RcFxStripCache
+{
+public:
+    static constexpr uint8_t ENTRIES = RCFXCACHEENTRIES;
+    static_assert((ENTRIES & (ENTRIES - 1)) == 0, "RCFXCACHEENTRIES must be a power of 2");
+
+    uint32_t tags[ENTRIES];     // Address of the strip in each slot. Flash addresses are only 24 bit, so 0xFFFFFFFF is never valid
+    uint32_t data[ENTRIES];
+    uint16_t hits = 0;
+    uint16_t misses = 0;
+
+    RcFxStripCache()
+    {
+        this->clear();
+    }
+
+    // Forget everything. Only needed if the data in flash changes (save data, etc)
+    void clear()
+    {
+        memset(this->tags, 0xFF, sizeof(this->tags));
+    }
+
+    void resetCounters()
+    {
+        this->hits = 0;
+        this->misses = 0;
+    }
+
+    static inline uint8_t slotFor(uint24_t address)
+    {
+        // Strips within a tile are only a few bytes apart, so the low bits spread them out nicely
+        return ((uint8_t)address ^ (uint8_t)(address >> 8)) & (ENTRIES - 1);
+    }
+
+    // Get the strip at the given address if it's cached. Counts as a hit or a miss
+    bool lookup(uint24_t address, uint32_t & data)
+    {
+        uint8_t slot = slotFor(address);
+
+        if(this->tags[slot] != address)
+        {
+            this->misses++;
+            return false;
+        }
+
+        this->hits++;
+        data = this->data[slot];
+        return true;
+    }
+
+    // Store a strip that was read after a failed lookup
+    inline void fill(uint24_t address, uint32_t data)
+    {
+        uint8_t slot = slotFor(address);
+        this->tags[slot] = address;
+        this->data[slot] = data;
+    }
+
+    uint32_t read(uint24_t address)
+    {
+        uint32_t result;
+        if(!this->lookup(address, result))
+        {
+            FX::readDataObject<uint32_t>(address, result);
+            this->fill(address, result);
+        }
+        return result;
+    }
+};
+
+// A texture strip read which has been started with beginStrip but not finished
+struct RcFxStripRead
+{
+    uint24_t address;
+    uint32_t data;
+    bool pending;       // If false, the data was already available (cache hit, fixed texture, etc)
+};
+
+
+// A container for precalculated sprite information. These are calculations we
+// don't want to do per-frame
+struct RcSpriteDrawPrecalc
+{
+    float fposX;
+    float fposY;
+    float invDet;
+};
+
+// A container for calculated sprite draw data. You know a calculation was not performed
+// if stepX and stepY are 0
+struct RcSpriteDrawData
+{
+    uint8_t drawStartX;
+    uint8_t drawStartY;
+    uint8_t drawEndY;
+    uint8_t drawEndX;
+
+    MipMapInfo mminfo;
+
+    uflot texXInit;
+    uflot texYInit;
+    uflot stepX = 0;
+    uflot stepY = 0;
+
+    uflot transformY;
+};
+
+enum RcShadingType : uint8_t
+{
+    None,
+    Black,
+    White
+};
+
+struct RcShadeInfo
+{
+    uint8_t shading;
+    RcShadingType type;
+};
+
+// A fully calculated wall column, just waiting for its texture to finish reading
+struct RcFxWallColumn
+{
+    uint8_t x;
+    uint16_t lineHeight;
+    UFixed<16,16> step;
+    RcShadeInfo shading;
+    uint32_t texData;
+};
+
+#define RCMASKTOP(shading, shade, yofs) \
+    if(shading.type == RcShadingType::White) shade &= pgm_read_byte(shade_mask + yofs); \
+    else shade |= ~pgm_read_byte(shade_mask + yofs);
+#define RCMASKBOTTOM(shading, shade, yofs) \
+    if(shading.type == RcShadingType::White) shade &= ~pgm_read_byte(shade_mask + yofs); \
+    else shade |= pgm_read_byte(shade_mask + yofs);
+
+// Template argument for the drawing kernels (drawWallLine, drawSpriteStripes) meaning the setting
+// is read at runtime rather than compiled in, see RCSPECIALIZEKERNELS
+constexpr uint8_t RCKERNELDYNAMIC = 0xFF;
+
+// Raycast renderer container, tracks data used for raycasting + lets you render raycasting.
+// Layout is how the tiles + sprites are stored in the fxdata (see RcFxLayout32)
+template<uint8_t W, uint8_t H, typename Layout = RcFxLayout32>
+class RcRender
+{
+public:
+    static constexpr uint8_t VIEWWIDTH = W;
+    static constexpr uint8_t VIEWHEIGHT = H;
+    static constexpr uint8_t VIEWHEIGHTBYTES = VIEWHEIGHT >> 3;
+    static constexpr uint8_t MIDSCREENY = VIEWHEIGHT / 2;
+    static constexpr uint8_t MIDSCREENX = VIEWWIDTH / 2;
+    static constexpr uflot INVWIDTH = 1.0 / VIEWWIDTH;
+    static constexpr float INVHEIGHT = 1.0 / VIEWHEIGHT;
+    static constexpr flot INVWIDTH2 = 2.0f / VIEWWIDTH;
+    static constexpr uint16_t MAXLHEIGHT = 32768;
+    static constexpr float MINLDISTANCE = 1.0f / MAXLHEIGHT;
+    static constexpr float MINSPRITEDISTANCE = 0.2;
+    static constexpr uflot SPRITEVIEWEXENTSION = 1;
+
+    uflot lightintensity = 1.0;     // Impacts view distance + shading even when no shading applied
+    uint24_t tilesheet;
+    uint24_t spritesheet;
+    uint24_t spritesheet_mask;
+    muflot spritescaling[4] = { 1.5, 1.0, 0.5, 0.25 };
+
+    uint8_t cornershading = 1;
+    RcShadingType shading = RcShadingType::Black;
+    RcShadingType altWallShading = RcShadingType::Black;
+    RcShadingType spriteShading = RcShadingType::None; //Sprite shading is kinda weird
+
+    // I want these to be private but they're needed elsewhere
+    uflot _viewdistance = 4.0;      // Calculated value
+    uflot _darkness = 1.0;          // Calculated value
+    uflot _distCache[VIEWWIDTH / 2]; // Half distance resolution means sprites will clip 1 pixel into walls sometimes but otherwise...
+
+    #ifdef RCSHADINGTABLE
+    RcShadingTable<RCSHADINGTABLESIZE> _shadeTable;
+    #endif
+
+    #ifdef RCCACHERAYS
+    RcRayCache<VIEWWIDTH> _rays;
+    #endif
+
+    #ifdef RCGENERALDEBUG
+    Tinyfont * tinyfont;
+    #endif
+
+    #ifdef RCRENDERSTATS
+    RcRenderStats<VIEWWIDTH> stats;
+    #endif
+
+    #ifdef RCPROFILE
+    RcProfiler profiler;
+    #endif
+
+    #ifdef RCFXCACHE
+    RcFxStripCache stripCache;
+    #endif
+
+    RcRender()
+    {
+        #ifdef RCSHADINGTABLE
+        // For the starting light intensity, setLightIntensity rebuilds it after that
+        this->_shadeTable.build(this->_viewdistance, this->_darkness);
+        #endif
+    }
+
+    // Read a single 32 bit texture strip out of flash. All texture reads go through here
+    inline uint32_t readStrip(uint24_t address)
+    {
+        #ifdef RCFXCACHE
+        return this->stripCache.read(address);
+        #else
+        uint32_t result;
+        FX::readDataObject<uint32_t>(address, result);
+        return result;
+        #endif
+    }
+
+    // Start reading a strip but don't wait for it; the FX chip shifts in the first byte while you 
+    // do other work. Nothing else may use the FX chip until the matching endStrip!
+    inline void beginStrip(uint24_t address, RcFxStripRead * read)
+    {
+        read->address = address;
+        #ifdef RCFXCACHE
+        read->pending = !this->stripCache.lookup(address, read->data);
+        if(!read->pending)
+            return;
+        #else
+        read->pending = true;
+        #endif
+        FX::seekData(address);
+    }
+
+    // Finish a read started with beginStrip. Bytes are stored in the same order readStrip would
+    inline uint32_t endStrip(RcFxStripRead * read)
+    {
+        if(read->pending)
+        {
+            uint8_t * bytes = (uint8_t *)&read->data;
+            bytes[0] = FX::readPendingUInt8();
+            bytes[1] = FX::readPendingUInt8();
+            bytes[2] = FX::readPendingUInt8();
+            bytes[3] = FX::readPendingLastUInt8();
+            read->pending = false;
+            #ifdef RCFXCACHE
+            this->stripCache.fill(read->address, read->data);
+            #endif
+        }
+        return read->data;
+    }
+
+    #ifdef RCFXINTERLEAVEDSPRITES
+    // Finish reading an interleaved sprite stripe started with FX::seekData: 'bytes' of data then 
+    // 'bytes' of mask, all in the one transaction. Bytes past the strip are left 0
+    inline void endSpriteStrip(uint8_t bytes, uint32_t & data, uint32_t & mask)
+    {
+        uint8_t * dataBytes = (uint8_t *)&data;
+        uint8_t * maskBytes = (uint8_t *)&mask;
+        data = 0;
+        mask = 0;
+        for(uint8_t i = 0; i < bytes; i++)
+            dataBytes[i] = FX::readPendingUInt8();
+        bytes--;
+        for(uint8_t i = 0; i < bytes; i++)
+            maskBytes[i] = FX::readPendingUInt8();
+        maskBytes[bytes] = FX::readPendingLastUInt8();
+    }
+    #endif
+
+    // Clear the area represented by this raycaster
+    inline void clearRaycast(Arduboy2Base * arduboy)
+    {
+        fastClear(arduboy, 0, 0, VIEWWIDTH, VIEWHEIGHT);
+    }
+
+    // Draw a fast(?) raycast background, assumed to start at 0,0. Your background should
+    // NOT have the usual width/height. Will underdraw in the Y direction if VIEWHEIGHT not 
+    // a multiple of 8
+    inline void drawRaycastBackground(Arduboy2Base * arduboy, const uint8_t * bg)
+    {
+        RCPROFILESTART(t);
+        for(uint8_t i = 0; i < VIEWHEIGHTBYTES; ++i)
+            memcpy_P(arduboy->sBuffer + i * WIDTH, bg + i * VIEWWIDTH, VIEWWIDTH);
+        RCPROFILEMARK(t, RcProfilePhase::Background);
+    }
+
+    // Calculate the appropriate shading for this wall slice given our rendering config
+    inline RcShadeInfo calculateShading(uflot distance, uint8_t x, RcShadingType shading)
+    {
+        if(shading == RcShadingType::None)
+        {
+            return RcShadeInfo {
+                0xFF,
+                RcShadingType::Black
+            };
+        }
+        else
+        {
+            RcShadeInfo result {
+                #ifdef RCSHADINGTABLE
+                this->_shadeTable.shade(distance, x),
+                #else
+                calcShading(distance, x, this->_darkness),
+                #endif
+                shading
+            };
+            if(shading == RcShadingType::White)
+                result.shading = ~result.shading;
+            return result;
+        }
+    }
+
+    // Set the light intensity for raycasting. Performs several expensive calculations, only set this
+    // when necessary
+    void setLightIntensity(uflot intensity)
+    {
+        // Skip complicated calcs
+        if(intensity == this->lightintensity)
+            return;
+
+        this->lightintensity = intensity;
+        this->_viewdistance = sqrt(BAYERGRADIENTS * (float)intensity);
+        this->_darkness = 1 / intensity;
+        #ifdef RCSHADINGTABLE
+        this->_shadeTable.build(this->_viewdistance, this->_darkness);
+        #endif
+    }
+
+    // The full function for raycasting. Works with any map type that has getIndex, getTile and
+    // width (RcMap or RcPackedMap)
+    template<typename MapType>
+    void raycastWalls(RcPlayer * p, MapType * map, Arduboy2Base * arduboy)
+    {
+        uint8_t pmapX = p->posX.getInteger();
+        uint8_t pmapY = p->posY.getInteger();
+        rcmapindex startMapIndex = map->getIndex(pmapX, pmapY);
+        uflot pmapofsX = p->posX - pmapX;
+        uflot pmapofsY = p->posY - pmapY;
+        flot fposX = (flot)p->posX, fposY = (flot)p->posY;
+        #ifndef RCCACHERAYS
+        flot dX = p->dirX, dY = p->dirY;
+        #endif
+        uflot viewdistance = this->_viewdistance;
+        uflot * distCache = this->_distCache;
+
+        RCSTAT(this->stats.reset();)
+
+        #ifdef RCCACHERAYS
+        RcRayCache<VIEWWIDTH> * rays = &this->_rays;
+        rays->update(p->dirX, p->dirY);
+        #endif
+        RCPROFILESTART(t);
+
+        // The column waiting to be drawn. With RCFXPIPELINE, each column is only drawn after the 
+        // next column's texture read has been started
+        RcFxWallColumn column {};
+        RcFxStripRead read {};
+        bool columnReady = false;
+
+        #ifdef RCFXSORTEDFETCH
+        RcFxWallColumn batch[RCFXBATCH];
+        uint24_t batchAddresses[RCFXBATCH];
+        uint8_t batchCount = 0;
+        #endif
+
+        for (uint8_t x = 0; x < VIEWWIDTH; x++)
+        {
+            #ifdef RCCACHERAYS
+            // Everything here was calculated when the player last turned. The deltas are already
+            // reciprocals, and are 0 (so fail the check below) if that direction isn't stepped
+            flot rayDirX = rays->rayDirX[x];
+            flot rayDirY = rays->rayDirY[x];
+            uflot deltaDistX = rays->deltaDistX[x];
+            uflot deltaDistY = rays->deltaDistY[x];
+            #else
+            flot cameraX = x * INVWIDTH2 - 1; // x-coordinate in camera space
+
+            // The camera plane is a simple -90 degree rotation on the player direction (as required for this algorithm).
+            flot rayDirX = dX + dY * cameraX;
+            flot rayDirY = dY - dX * cameraX;
+
+            // length of ray from one x or y-side to next x or y-side. But we prefill it with
+            // some initial data which has to be massaged later.
+            uflot deltaDistX = (uflot)abs(rayDirX); //Temp value; may not be used
+            uflot deltaDistY = (uflot)abs(rayDirY); //same
+            #endif
+
+            // length of ray from current position to next x or y-side
+            uflot sideDistX = MAXFIXED;
+            uflot sideDistY = MAXFIXED;
+
+            // what direction to step in x or y-direction (either +1 or -1)
+            int8_t stepX = 0;
+            rcmapstep stepY = 0;
+
+            // With this DDA stepping algorithm, have to be careful about making too-large values
+            // with our tiny fixed point numbers. Make some arbitrarily small cutoff point for
+            // even trying to deal with steps in that direction. As long as the map size is 
+            // never larger than 1 / NEARZEROFIXED on any side, it will be fine (that means
+            // map has to be < 100 on a side with this)
+            if(deltaDistX > NEARZEROFIXED) {
+                #ifndef RCCACHERAYS
+                deltaDistX = uReciprocalNearUnit(deltaDistX); 
+                #endif
+                if (rayDirX < 0) {
+                    stepX = -1;
+                    sideDistX = pmapofsX * deltaDistX;
+                }
+                else {
+                    stepX = 1;
+                    sideDistX = (1 - pmapofsX) * deltaDistX;
+                }
+            }
+            if(deltaDistY > NEARZEROFIXED) {
+                #ifndef RCCACHERAYS
+                deltaDistY = uReciprocalNearUnit(deltaDistY); 
+                #endif
+                if (rayDirY < 0) {
+                    stepY = -map->width;
+                    sideDistY = pmapofsY * deltaDistY;
+                }
+                else {
+                    stepY = map->width;
+                    sideDistY = (1 - pmapofsY) * deltaDistY;
+                }
+            }
+
+            uint8_t side;           // was a NS or a EW wall hit?
+            rcmapindex mapIndex = startMapIndex;
+            uflot perpWallDist = 0;   // perpendicular distance (not real distance)
+            uint8_t tile;
+            RCSTAT(uint8_t ddaSteps = 0;)
+
+            // perform DDA. A do/while loop is ever-so-slightly faster it seems?
+            do
+            {
+                RCSTAT(ddaSteps++;)
+                // jump to next map square, either in x-direction, or in y-direction
+                if (sideDistX < sideDistY) {
+                    perpWallDist = sideDistX; // Remember that sideDist is actual distance and not distance only in 1 direction
+                    sideDistX += deltaDistX;
+                    mapIndex += stepX;
+                    side = 0; //0 = xside hit
+                }
+                else {
+                    perpWallDist = sideDistY;
+                    sideDistY += deltaDistY;
+                    mapIndex += stepY;
+                    side = 1; //1 = yside hit
+                }
+                tile = map->getTile(mapIndex);
+            }
+            while (perpWallDist < viewdistance && tile == RCEMPTY);
+
+            RCSTAT(this->stats.recordColumn(x, ddaSteps);)
+
+            //Only calc distance for every other point to save a lot of memory (100 bytes)
+            if((x & 1) == 0)
+                distCache[x >> 1] = perpWallDist;
+
+            // If the above loop was exited without finding a tile, there's nothing to draw
+            if(tile == RCEMPTY) continue;
+
+            // Figure out NOW what the line height and mipmap level is is. Note: I've tried many types for this
+            // invLineHeight, since it's used so much, but float actually seems to work best...
+            float invLineHeight = INVHEIGHT * (float)perpWallDist; 
+            uint8_t mipmap = Layout::TILESIZE * invLineHeight;
+            if(mipmap >= Layout::MIPSTEPS) break;
+            MipMapInfo mminfo = get_mipmap_info<Layout>(mipmap);
+
+            //NOTE: wallX technically can only be positive, but I'm using flot to save a tiny amount from casting
+            flot wallX = side ? fposX + (flot)perpWallDist * rayDirX : fposY + (flot)perpWallDist * rayDirY;
+            uint8_t texX = uint8_t((wallX - floorFixed(wallX)) * mminfo.width); //.getFraction isn't what you think!
+            if((side == 0 && rayDirX > 0) || (side == 1 && rayDirY < 0)) texX = mminfo.width - 1 - texX;
+
+            UFixed<16,16> step = mminfo.width * invLineHeight;
+            uint16_t lineHeight = (invLineHeight <= MINLDISTANCE) ? MAXLHEIGHT : (uint16_t)(1 / invLineHeight);
+
+            uint24_t texAddress = RCFXNOREAD;
+
+            if((side & x) && this->altWallShading != RcShadingType::None)
+            {
+                read.data = this->altWallShading == RcShadingType::Black ? 0x0 : 0xFFFFFFFF;
+                read.pending = false;
+            }
+            else
+            {
+                texAddress = this->tilesheet + tile * Layout::FRAMEBYTES + mminfo.offset + texX * mminfo.bytes;
+                #ifndef RCFXSORTEDFETCH
+                this->beginStrip(texAddress, &read);
+                #endif
+            }
+
+            #ifdef RCLINEHEIGHTDEBUG
+            tinyfont.setCursor(16, x * 16);
+            tinyfont.println(lineHeight);
+            tinyfont.setCursor(16, x * 16 + 8);
+            tinyfont.println((float)perpWallDist);
+            #ifndef RCFXSORTEDFETCH
+            if(x > 2) { this->endStrip(&read); break; }
+            #else
+            if(x > 2) break;
+            #endif
+            #endif
+
+            #ifdef RCFXSORTEDFETCH
+            // Only gather the column for now; the texture is read along with the rest of the batch
+            RcFxWallColumn * entry = batch + batchCount;
+            entry->x = x;
+            entry->lineHeight = lineHeight;
+            entry->step = step;
+            entry->shading = calculateShading(perpWallDist, x, this->shading);
+            entry->texData = read.data;
+            batchAddresses[batchCount] = texAddress;
+            if(++batchCount == RCFXBATCH)
+            {
+                this->drawWallBatch(batch, batchAddresses, batchCount, arduboy);
+                batchCount = 0;
+            }
+            #else
+
+            #ifdef RCFXPIPELINE
+            // Draw the previous column while this column's texture is coming in
+            if(columnReady)
+                this->drawWallColumn(&column, arduboy);
+            #endif
+
+            column.x = x;
+            column.lineHeight = lineHeight;
+            column.step = step;
+            column.shading = calculateShading(perpWallDist, x, this->shading);
+            column.texData = this->endStrip(&read);
+            columnReady = true;
+
+            #ifndef RCFXPIPELINE
+            //ending should be exclusive
+            this->drawWallColumn(&column, arduboy);
+            columnReady = false;
+            #endif
+
+            #endif
+        }
+
+        #ifdef RCFXSORTEDFETCH
+        if(batchCount)
+            this->drawWallBatch(batch, batchAddresses, batchCount, arduboy);
+        #endif
+
+        // The last column is still waiting
+        if(columnReady)
+            this->drawWallColumn(&column, arduboy);
+
+        RCPROFILEMARK(t, RcProfilePhase::Walls);
+    }
+
+    #ifdef RCFXSORTEDFETCH
+    // Read the textures for a batch of wall columns in flash address order, then draw them all.
+    // Columns which don't need a read have the address RCFXNOREAD. Walls are usually many columns of
+    // the same tile, so in address order most strips are right next to (or overlapping) the last
+    // one, and the whole batch comes in as a few continuous reads instead of a seek per column.
+    // Note that this does not go through the strip cache.
+    void drawWallBatch(RcFxWallColumn * columns, uint24_t * addresses, uint8_t count, Arduboy2Base * arduboy)
+    {
+        uint8_t order[RCFXBATCH];
+        uint8_t reads = 0;
+
+        // Insertion sort (by address) the columns which need reading
+        for(uint8_t i = 0; i < count; i++)
+        {
+            uint24_t address = addresses[i];
+            if(address == RCFXNOREAD)
+                continue;
+
+            int8_t insertPos = reads - 1;
+            while(insertPos >= 0 && addresses[order[insertPos]] > address)
+            {
+                order[insertPos + 1] = order[insertPos];
+                insertPos--;
+            }
+            order[insertPos + 1] = i;
+            reads++;
+        }
+
+        uint24_t position = RCFXNOREAD;     // Where the current read is up to, if there is one
+        uint32_t last = 0;                  // The last strip read, which is the 4 bytes before position
+
+        for(uint8_t i = 0; i < reads; i++)
+        {
+            RcFxWallColumn * column = columns + order[i];
+            uint24_t address = addresses[order[i]];
+            uint8_t * bytes = (uint8_t *)&column->texData;
+            uint8_t have = 0;
+
+            // Because of the sort, the address is never before the last strip
+            if(position != RCFXNOREAD && address <= position + RCFXMAXSKIP)
+            {
+                if(address < position)
+                {
+                    // Overlaps the last strip (smaller mipmaps have strips less than 4 bytes apart) or is the same strip
+                    have = position - address;
+                    const uint8_t * lastBytes = (const uint8_t *)&last;
+                    for(uint8_t j = 0; j < have; j++)
+                        bytes[j] = lastBytes[4 - have + j];
+                }
+                else
+                {
+                    for(; position < address; position++)
+                        FX::readPendingUInt8();
+                }
+            }
+            else
+            {
+                if(position != RCFXNOREAD)
+                    FX::readEnd();
+                FX::seekData(address);
+            }
+
+            for(uint8_t j = have; j < 4; j++)
+                bytes[j] = FX::readPendingUInt8();
+
+            position = address + 4;
+            last = column->texData;
+        }
+
+        if(position != RCFXNOREAD)
+            FX::readEnd();
+
+        for(uint8_t i = 0; i < count; i++)
+            this->drawWallColumn(columns + i, arduboy);
+    }
+    #endif
+
+    //Draw a single raycast wall line. Will only draw specifically the wall line and will clip out all the rest
+    //(so you can predraw a ceiling and floor before calling raycast)
+    //ShadeType compiles the shading type into the loops (see drawWallColumn), otherwise it's read from shading
+    //void drawWallLine(uint8_t x, uflot distance, RcShadeInfo shading, uint16_t texData, Arduboy2Base * arduboy)
+    template<uint8_t ShadeType = RCKERNELDYNAMIC>
+    void drawWallLine(uint8_t x, uint16_t lineHeight, UFixed<16,16> step, RcShadeInfo shading, uint32_t texData, Arduboy2Base * arduboy)
+    {
+        // With the type known, every type check in the macros below folds away. calculateShading gives
+        // no shading as black shading that lets everything through, so the black kernel draws that too
+        if(ShadeType != RCKERNELDYNAMIC)
+            shading.type = (RcShadingType)ShadeType;
+        uint8_t cornershading = this->cornershading;
+
+        // ------- BEGIN CRITICAL SECTION -------------
+        int16_t halfLine = lineHeight >> 1;
+        uint8_t yStart = max(0, MIDSCREENY - halfLine);
+        uint8_t yEnd = min(VIEWHEIGHT, MIDSCREENY + halfLine); //EXCLUSIVE
+
+        RCSTAT(this->stats.wallColumns++; this->stats.wallPixels += yEnd - yStart;)
+
+        //Everyone prefers the high precision tiles (and for some reason, it's now faster? so confusing...)
+        UFixed<16,16> texPos = (yStart + halfLine - MIDSCREENY) * step;
+
+        //These four variables are needed as part of the loop unrolling system
+        uint16_t bofs;
+        uint8_t texByte;
+        uint8_t thisWallByte = yStart;
+        TOBYTECOUNT(thisWallByte);
+        uint8_t * sbuffer = arduboy->sBuffer;
+        uint8_t shade = shading.shading;
+
+        uint8_t accustep = (step.getFraction() >> 8);
+        uint8_t accum = (texPos.getFraction() >> 8);
+        texData >>= texPos.getInteger();
+
+        //Pull wall byte, save location
+        #define _WALLREADBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs];
+        //Write previously read wall byte, go to next byte
+        #define _WALLWRITENEXT(mixin) if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & shade) mixin; } else { sbuffer[bofs] = (texByte | shade) mixin;} thisWallByte++;
+        //Work for setting bits of wall byte. Use an imperfect overflow accumulator to approximate stepping through texture.
+        #define _WALLBITUNROLL(bm,nbm) \
+            if(texData & 1) texByte |= (bm); \
+            else texByte &= (nbm); \
+            accum += accustep; \
+            if (accum < accustep) { texData >>= 1; }
+
+        _WALLREADBYTE();
+
+        #ifndef RCSMALLLOOPS
+
+        uint8_t startByte = thisWallByte; //The byte within which we start, always inclusive
+        uint8_t endByte = yEnd;
+        TOBYTECOUNT(endByte);
+
+        uint8_t yofs = yStart & 7;
+
+        //First and last bytes are tricky
+        if(yofs)
+        {
+            uint8_t endFirst = min((startByte + 1) * 8, yEnd);
+            uint8_t bm = fastlshift8(yofs);
+
+            for (uint8_t i = yStart; i < endFirst; i++) {
+                _WALLBITUNROLL(bm, (~bm));
+                bm <<= 1;
+            }
+
+            //Move to next, like it never happened (but mask shading)
+            RCMASKTOP(shading, shade, yofs);
+            _WALLWRITENEXT();
+            _WALLREADBYTE();
+            shade = shading.shading;
+        }
+
+        // Now the unrolled loop
+        while (thisWallByte < endByte)
+        {
+            _WALLBITUNROLL(0b00000001, 0b11111110);
+            _WALLBITUNROLL(0b00000010, 0b11111101);
+            _WALLBITUNROLL(0b00000100, 0b11111011);
+            _WALLBITUNROLL(0b00001000, 0b11110111);
+            _WALLBITUNROLL(0b00010000, 0b11101111);
+            _WALLBITUNROLL(0b00100000, 0b11011111);
+            _WALLBITUNROLL(0b01000000, 0b10111111);
+            _WALLBITUNROLL(0b10000000, 0b01111111);
+            _WALLWRITENEXT();
+            _WALLREADBYTE();
+        }
+
+        yofs = yEnd & 7;
+        //Last byte, but only need to do it if we don't simply span one byte
+        if(yofs && startByte != endByte)
+        {
+            uint8_t bm = 1;
+            for (uint8_t i = thisWallByte * 8; i < yEnd; i++) {
+                _WALLBITUNROLL(bm, (~bm));
+                bm <<= 1;
+            }
+
+            //"Don't repeat yourself": that ship has sailed. Anyway, only write the last byte if we need to, otherwise
+            //we could legitimately write outside the bounds of the screen.
+            RCMASKBOTTOM(shading, shade, yofs);
+            if(cornershading) { _WALLWRITENEXT(& ~(fastlshift8(yofs))); }
+            else { _WALLWRITENEXT(); }
+        }
+
+        #else // No loop unrolling
+
+        //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
+        if((yStart & 7) == 0) thisWallByte--;
+        uint8_t bm = fastlshift8(yStart & 7);
+
+        do
+        {
+            uint8_t bidx = yStart & 7;
+
+            // Every new byte, save the current (previous) byte and load the new byte from the screen. 
+            // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
+            if(bidx == 0) {
+                bm = 1;
+                _WALLWRITENEXT();
+                _WALLREADBYTE();
+            }
+
+            _WALLBITUNROLL(bm, ~bm);
+            bm <<= 1;
+        }
+        while(++yStart < yEnd);
+
+        if(cornershading && yEnd != VIEWHEIGHT) { _WALLWRITENEXT(& ~(fastlshift8(yEnd & 7))); }
+        else { _WALLWRITENEXT(); }
+
+        #endif
+
+        // ------- END CRITICAL SECTION -------------
+    }
+
+    // Draw a wall column. With RCSPECIALIZEKERNELS, this picks the drawWallLine instance for the shading
+    // type, so the type is checked once per column rather than on every byte written. Only black and
+    // white get their own copy of the loops: no shading is drawn as black (see drawWallLine). These
+    // are direct calls rather than a pointer picked once per frame, so the compiler can still inline them
+    inline void drawWallColumn(RcFxWallColumn * column, Arduboy2Base * arduboy)
+    {
+        #ifdef RCSPECIALIZEKERNELS
+        if(column->shading.type == RcShadingType::White)
+            drawWallLine<RcShadingType::White>(column->x, column->lineHeight, column->step, column->shading, column->texData, arduboy);
+        else
+            drawWallLine<RcShadingType::Black>(column->x, column->lineHeight, column->step, column->shading, column->texData, arduboy);
+        #else
+        drawWallLine(column->x, column->lineHeight, column->step, column->shading, column->texData, arduboy);
+        #endif
+    }
+
+
+    //Precalculate some sprite drawing stuff, happens before any loop, not tied to a sprite
+    RcSpriteDrawPrecalc precalcSpriteDraw(RcPlayer * player)
+    {
+        RcSpriteDrawPrecalc result;
+
+        result.fposX = (float)player->posX;
+        result.fposY = (float)player->posY;
+        result.invDet = 1.0 / (player->dirY * player->dirY + player->dirX * player->dirX); // required for correct matrix multiplication
+
+        return result;
+    }
+
+    // Setup culling for the sprites this frame. Has to be done after raycastWalls (needs the distance cache)
+    RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> precalcSpriteCull(RcSpriteDrawPrecalc * calc, RcPlayer * player)
+    {
+        RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> result;
+
+        result.posX = calc->fposX;
+        result.posY = calc->fposY;
+        result.dirX = player->dirX;
+        result.dirY = player->dirY;
+        result.invDet = calc->invDet;
+        result.minDepth = MINSPRITEDISTANCE;
+        // Past the view distance, shaded sprites would only be a dark silhouette with no walls around them
+        uflot extension = SPRITEVIEWEXENTSION;
+        result.maxDepth = this->spriteShading == RcShadingType::None ? 0 : (float)(this->_viewdistance + extension);
+        result.scaling = this->spritescaling;
+        result.distCache = this->_distCache;
+
+        return result;
+    }
+
+    template<uint8_t InternalStateBytes>
+    RcSpriteDrawData calcSpriteDraw(RcSpriteDrawPrecalc * calc, RcPlayer * player, RcSprite<InternalStateBytes> * sprite)
+    {
+        RcSpriteDrawData result;
+
+        float spriteX = (float)sprite->x - calc->fposX;
+        float spriteY = (float)sprite->y - calc->fposY;
+
+        float transformYT = calc->invDet * (player->dirX * spriteX + player->dirY * spriteY); // this is actually the depth inside the screen, that what Z is in 3D
+
+        // Nice quick shortcut to get out for sprites behind us (and ones that are too close / far)
+        if (transformYT < MINSPRITEDISTANCE ) //|| transformYT > _viewdistance + SPRITEVIEWEXENTSION) //_sviewdistance)
+            return result;
+
+        float invTransformYT = 1 / transformYT;
+        float transformXT = calc->invDet * (player->dirY * spriteX - player->dirX * spriteY);
+
+        // int16 because easy overflow! if x is much larger than y, then you're effectively multiplying 50 by map width.
+        //  NOTE: this is the CENTER of the sprite, not the edge (thankfully)
+        int16_t spriteScreenX = int16_t(MIDSCREENX * (1 + transformXT * invTransformYT));
+
+        // calculate the dimensions of the sprite on screen. All sprites are square. Size mods go here
+        // using 'transformY' instead of the real distance prevents fisheye
+        float scale = (float)this->spritescaling[(sprite->state & RSSTATESIZE) >> 1];
+        uint16_t spriteHeight = uint16_t(VIEWHEIGHT * invTransformYT * scale);
+        uint16_t spriteWidth = spriteHeight;
+
+        // calculate lowest and highest pixel to fill. Sprite screen/start X and Sprite screen/start Y
+        // Because we have 1 fewer bit to store things, we unfortunately need an int16
+        int16_t ssX = -(spriteWidth >> 1) + spriteScreenX; // Offsets go here, but modified by distance or something?
+        int16_t ssXe = ssX + spriteWidth;                  // EXCLUSIVE
+
+        // Get out if sprite is completely outside view (the ends are exclusive, so touching the edge is outside)
+        if (ssXe <= 0 || ssX >= VIEWWIDTH)
+            return result;
+
+        // Calculate vertical shift from top 5 bits of state
+        uint8_t yShiftBits = sprite->state;
+        TOBYTECOUNT(yShiftBits); //((sprite->state >> 1) >> 1) >> 1;
+        int16_t yShift = yShiftBits ? int16_t((yShiftBits & 16 ? -(yShiftBits & 15) : (yShiftBits & 15)) * max(scale, 1.0) * 2.0 * invTransformYT) : 0;
+        // The above didn't work without float math, didn't feel like figuring out the ridiculous type casting
+
+        int16_t ssY = -(spriteHeight >> 1) + MIDSCREENY + yShift;
+        int16_t ssYe = ssY + spriteHeight; // EXCLUSIVE
+
+        if (ssYe <= 0 || ssY >= VIEWHEIGHT)
+            return result;
+
+        float invHeight = 1.0 / spriteHeight;
+        uint8_t mipmap = Layout::TILESIZE * invHeight;
+        if(mipmap >= Layout::MIPSTEPS) return result;
+        result.mminfo = get_mipmap_info<Layout>(mipmap);
+
+        result.drawStartY = ssY < 0 ? 0 : ssY; // Because of these checks, we can store them in 1 byte stuctures
+        result.drawEndY = ssYe > VIEWHEIGHT ? VIEWHEIGHT : ssYe;
+        result.drawStartX = ssX < 0 ? 0 : ssX;
+        result.drawEndX = ssXe > VIEWWIDTH ? VIEWWIDTH : ssXe;
+
+        // Setup stepping to avoid costly mult (and div) in critical loops
+        // These float divisions happen just once per sprite, hopefully that's not too bad.
+        // There used to be an option to set the precision of sprites but it didn't seem to make any difference
+        float stepXf = (float)result.mminfo.width / spriteWidth;
+        float stepYf = result.mminfo.width * invHeight;
+
+        result.texXInit = (result.drawStartX - ssX) * stepXf; // This unfortunately needs float because of precision glitches
+        result.texYInit = (result.drawStartY - ssY) * stepYf;
+        result.stepX = stepXf;
+        result.stepY = stepYf;
+        result.transformY = (uflot)transformYT;
+
+        #ifdef RCPRINTSPRITEDATA
+        //Clear a section for us to use
+        constexpr uint8_t sdh = 10;
+        arduboy->fillRect(0, HEIGHT - sdh, VIEWWIDTH, sdh, BLACK);
+        //Print some junk
+        tinyfont->setCursor(0, HEIGHT - sdh);
+        tinyfont->print((float)transformXT, 4);
+        tinyfont->print(" Y");
+        tinyfont->print(ssY);
+        tinyfont->setCursor(0, HEIGHT - sdh + 5);
+        tinyfont->print((float)transformYT, 4);
+        tinyfont->print(" W");
+        tinyfont->print(spriteWidth);
+        #endif
+
+        return result;
+    }
+
+
+    //Draw the stripes of one projected sprite (see calcSpriteDraw) from the given sheets, skipping any
+    //stripe behind a wall. ShadeType compiles the sprite shading type into the loops (see drawSpriteKernel),
+    //otherwise it's read from this->spriteShading
+    template<uint8_t ShadeType = RCKERNELDYNAMIC>
+    void drawSpriteStripes(RcSpriteDrawData drawData, const uint24_t spritesheet, const uint24_t spritesheet_Mask, uint8_t fr, Arduboy2Base * arduboy)
+    {
+        uint8_t * sbuffer = arduboy->sBuffer;
+        uflot * distCache = this->_distCache;
+        uflot texX = drawData.texXInit;
+
+        uint8_t drawStartByte = drawData.drawStartY;
+        TOBYTECOUNT(drawStartByte); 
+        uint8_t drawEndByte = drawData.drawEndY;
+        TOBYTECOUNT(drawEndByte); 
+        uint32_t texData = 0;
+        uint32_t texMask = 0;
+
+        uint8_t accumStart = drawData.texYInit.getFraction();
+        uint8_t accustep = drawData.stepY.getFraction();
+        uint8_t preshift = drawData.texYInit.getInteger();
+
+        uint8_t x = drawData.drawStartX;
+
+        #ifdef RCFXINTERLEAVEDSPRITES
+        // Each stripe is its data bytes followed by its mask bytes, and frames are twice the size
+        const uint24_t frameStart = spritesheet + (uint24_t)fr * (2 * Layout::FRAMEBYTES) + 2 * drawData.mminfo.offset;
+        const uint8_t stripeBytes = 2 * drawData.mminfo.bytes;
+        (void)spritesheet_Mask;
+        #endif
+
+        #ifdef RCFXPIPELINE
+        #ifdef RCFXINTERLEAVEDSPRITES
+        // The next stripe (data and mask together) is read while this stripe draws
+        uint32_t nextData;
+        uint32_t nextMask;
+        #else
+        // Only one read can be in flight, so the next stripe's data is read while this stripe 
+        // draws, and only the mask read has to be waited on
+        RcFxStripRead nextRead;
+        #endif
+        bool prefetching = false;
+        bool prefetched = false;
+        #endif
+
+        // ------- BEGIN CRITICAL SECTION -------------
+        do //For every strip (x)
+        {
+            //If the sprite is hidden, skip this line. Lots of calculations bypassed!
+            if (drawData.transformY < distCache[x >> 1])
+            {
+                uint8_t tx = texX.getInteger();
+
+                #if defined(RCFXINTERLEAVEDSPRITES) && defined(RCFXPIPELINE)
+                if(prefetched)
+                {
+                    texData = nextData;
+                    texMask = nextMask;
+                }
+                else
+                {
+                    FX::seekData(frameStart + tx * stripeBytes);
+                    this->endSpriteStrip(drawData.mminfo.bytes, texData, texMask);
+                }
+                #elif defined(RCFXINTERLEAVEDSPRITES)
+                FX::seekData(frameStart + tx * stripeBytes);
+                this->endSpriteStrip(drawData.mminfo.bytes, texData, texMask);
+                #else
+                #ifdef RCFXPIPELINE
+                texData = prefetched ? nextRead.data : this->readStrip(spritesheet + fr * Layout::FRAMEBYTES + tx * drawData.mminfo.bytes + drawData.mminfo.offset);
+                #else
+                texData = this->readStrip(spritesheet + fr * Layout::FRAMEBYTES + tx * drawData.mminfo.bytes + drawData.mminfo.offset);
+                #endif
+                texMask = this->readStrip(spritesheet_Mask + fr * Layout::FRAMEBYTES + tx * drawData.mminfo.bytes + drawData.mminfo.offset);
+                #endif
+                //texMask = 0xFFFFFFFF;
+                texData >>= preshift;
+                texMask >>= preshift;
+
+                //A small optimization for small sprites
+                if(!texMask) goto SKIPSPRITESTRIPE;
+
+                #ifdef RCFXPIPELINE
+                if(x + 1 < drawData.drawEndX && drawData.transformY < distCache[(x + 1) >> 1])
+                {
+                    uint8_t ntx = (texX + drawData.stepX).getInteger();
+                    #ifdef RCFXINTERLEAVEDSPRITES
+                    FX::seekData(frameStart + ntx * stripeBytes);
+                    #else
+                    this->beginStrip(spritesheet + fr * Layout::FRAMEBYTES + ntx * drawData.mminfo.bytes + drawData.mminfo.offset, &nextRead);
+                    #endif
+                    prefetching = true;
+                }
+                #endif
+
+                RCSTAT(this->stats.spriteStripes++; this->stats.spritePixels += drawData.drawEndY - drawData.drawStartY;)
+
+                RcShadeInfo shading = this->calculateShading(drawData.transformY, x, this->spriteShading);
+                if(ShadeType != RCKERNELDYNAMIC)
+                    shading.type = (RcShadingType)ShadeType;
+                uint8_t shade = shading.shading;
+
+                //These five variables (including texData+texMask) are needed as part of the loop unrolling system
+                uint16_t bofs;
+                uint8_t texByte;
+                uint8_t maskByte;
+                uint8_t thisWallByte = drawStartByte;
+
+                uint8_t accum = accumStart;
+
+                //Pull screen byte, save location
+                #define _SPRITEREADSCRBYTE() bofs = thisWallByte * WIDTH + x; texByte = sbuffer[bofs]; maskByte = 0;
+                //Write previously read screen byte, go to next byte
+                #define _SPRITEWRITESCRNEXT() if(shading.type == RcShadingType::Black) { sbuffer[bofs] = (texByte & (shade | ~maskByte)); } else { sbuffer[bofs] = (texByte | (shade & maskByte));} thisWallByte++;
+                //Work for setting bits of screen byte
+                #define _SPRITEBITUNROLL(bm,nbm) \
+                    if (texMask & 1) { if (texData & 1) texByte |= bm; else texByte &= nbm; maskByte |= bm; } \
+                    accum += accustep; \
+                    if (accum < accustep) { texData >>= 1; texMask >>= 1; }
+
+                    // asm volatile(
+                    //     "add %[accum], %[step]    \n"
+                    //     "brcc .+8       \n"
+                    //     "lsr %B[td]     \n"
+                    //     "ror %A[td]     \n"
+                    //     "lsr %B[td2]     \n"
+                    //     "ror %A[td2]     \n"
+                    //     : [accum] "+&r" (accum),
+                    //       [td] "+&r" (texData),
+                    //       [td2] "+&r" (texMask)
+                    //     : [step] "r" (accustep)
+                    // );
+                    //if(fullstep) { texMask >>= fullstep; texData >>= fullstep; }
+
+                _SPRITEREADSCRBYTE();
+
+                #ifndef RCSMALLLOOPS
+
+                uint8_t yofs = drawData.drawStartY & 7;
+
+                //First and last bytes are tricky
+                if(yofs)
+                {
+                    uint8_t endFirst = min((drawStartByte + 1) * 8, drawData.drawEndY);
+                    uint8_t bm = fastlshift8(yofs);
+
+                    for (uint8_t i = drawData.drawStartY; i < endFirst; i++)
+                    {
+                        _SPRITEBITUNROLL(bm, (~bm));
+                        bm <<= 1;
+                    }
+
+                    //Move to next, like it never happened
+                    RCMASKTOP(shading, shade, yofs);
+                    _SPRITEWRITESCRNEXT();
+                    _SPRITEREADSCRBYTE();
+                    shade = shading.shading;
+                }
+
+                //Now the unrolled loop
+                while (thisWallByte < drawEndByte)
+                {
+                    _SPRITEBITUNROLL(0b00000001, 0b11111110);
+                    _SPRITEBITUNROLL(0b00000010, 0b11111101);
+                    _SPRITEBITUNROLL(0b00000100, 0b11111011);
+                    _SPRITEBITUNROLL(0b00001000, 0b11110111);
+                    _SPRITEBITUNROLL(0b00010000, 0b11101111);
+                    _SPRITEBITUNROLL(0b00100000, 0b11011111);
+                    _SPRITEBITUNROLL(0b01000000, 0b10111111);
+                    _SPRITEBITUNROLL(0b10000000, 0b01111111);
+                    _SPRITEWRITESCRNEXT();
+                    _SPRITEREADSCRBYTE();
+                }
+
+                yofs = drawData.drawEndY & 7;
+
+                //Last byte, but only need to do it if we end in the middle of a byte and don't simply span one byte
+                if(yofs && drawStartByte != drawEndByte)
+                {
+                    uint8_t endStart = thisWallByte * 8;
+                    uint8_t bm = fastlshift8(endStart & 7);
+                    for (uint8_t i = endStart; i < drawData.drawEndY; i++)
+                    {
+                        _SPRITEBITUNROLL(bm, (~bm));
+                        bm <<= 1;
+                    }
+
+                    //Only need to set the last byte if we're drawing in it of course
+                    RCMASKBOTTOM(shading, shade, yofs);
+                    _SPRITEWRITESCRNEXT();
+                }
+
+                #else // No loop unrolling
+
+                uint8_t y = drawData.drawStartY;
+
+                //Funny hack; code is written for loop unrolling first, so we have to kind of "fit in" to the macro system
+                if((drawData.drawStartY & 7) == 0) thisWallByte--;
+
+                do
+                {
+                    uint8_t bidx = y & 7;
+
+                    // Every new byte, save the current (previous) byte and load the new byte from the screen. 
+                    // This might be wasteful, as only the first and last byte technically need to pull from the screen. 
+                    if(bidx == 0) {
+                        _SPRITEWRITESCRNEXT();
+                        _SPRITEREADSCRBYTE();
+                    }
+
+                    uint8_t bm = fastlshift8(bidx);
+                    _SPRITEBITUNROLL(bm, ~bm);
+                }
+                while(++y < drawData.drawEndY); //EXCLUSIVE
+
+                //The above loop specifically CAN'T reach the last byte, so although it's wasteful in the case of a 
+                //sprite ending at the bottom of the screen, it's still better than always incurring an if statement... maybe.
+                //if(drawData.drawEndY & 7)
+                _SPRITEWRITESCRNEXT();
+                //sbuffer[bofs] = texByte;
+
+                #endif
+
+            }
+
+            SKIPSPRITESTRIPE:
+            #ifdef RCFXPIPELINE
+            if(prefetching)
+            {
+                #ifdef RCFXINTERLEAVEDSPRITES
+                this->endSpriteStrip(drawData.mminfo.bytes, nextData, nextMask);
+                #else
+                this->endStrip(&nextRead);
+                #endif
+            }
+            prefetched = prefetching;
+            prefetching = false;
+            #endif
+            //This ONE step is why there has to be a big if statement up there. 
+            texX += drawData.stepX;
+        }
+        while(++x < drawData.drawEndX); //EXCLUSIVE
+        // ------- END CRITICAL SECTION -------------
+    }
+
+    #ifdef RCSPECIALIZEKERNELS
+    // Draw with the drawSpriteStripes instance for the sprite shading, see drawWallColumn
+    inline void drawSpriteKernel(RcSpriteDrawData drawData, const uint24_t spritesheet, const uint24_t spritesheet_Mask, uint8_t fr, Arduboy2Base * arduboy)
+    {
+        if(this->spriteShading == RcShadingType::White) drawSpriteStripes<RcShadingType::White>(drawData, spritesheet, spritesheet_Mask, fr, arduboy);
+        else drawSpriteStripes<RcShadingType::Black>(drawData, spritesheet, spritesheet_Mask, fr, arduboy);
+    }
+    #endif
+
+    template<uint8_t InternalStateBytes>
+    void drawSprites(RcPlayer * player, RcSpriteGroup<InternalStateBytes> * group, Arduboy2Base * arduboy)
+    {
+        RCPROFILESTART(t);
+        RcSpriteDrawPrecalc precalc = precalcSpriteDraw(player);
+        RcSpriteCuller<VIEWWIDTH, VIEWHEIGHT> culler = precalcSpriteCull(&precalc, player);
+        uint8_t usedSprites = group->sortSprites(player->posX, player->posY, &culler);
+        RCPROFILEMARK(t, RcProfilePhase::SpriteSort);
+
+        // Buffers, we pull them out like this just to make it a little easier (might remove later)
+        const uint24_t spritesheet = this->spritesheet;
+        const uint24_t spritesheet_Mask = this->spritesheet_mask;
+
+        // after sorting the sprites, do the projection and draw them. We know all sprites in the array are active,
+        // since we're looping against the sorted array.
+        for (uint8_t i = 0; i < usedSprites; i++)
+        {
+            //Get the current sprite so we don't have to dereference multiple pointers
+            RcSprite<InternalStateBytes> * sprite = group->sortedSprites[i].sprite;
+
+            RcSpriteDrawData drawData = calcSpriteDraw(&precalc, player, sprite);
+            RCPROFILEMARK(t, RcProfilePhase::SpriteProject);
+
+            // Skip drawing, it was determined nothing was needed
+            if(drawData.stepX == 0 && drawData.stepY == 0) continue;
+
+            RCSTAT(this->stats.spritesDrawn++;)
+
+            #ifdef RCSPECIALIZEKERNELS
+            drawSpriteKernel(drawData, spritesheet, spritesheet_Mask, sprite->frame, arduboy);
+            #else
+            drawSpriteStripes(drawData, spritesheet, spritesheet_Mask, sprite->frame, arduboy);
+            #endif
+
+            RCPROFILEMARK(t, RcProfilePhase::SpriteDraw);
+
+        }
+    }
+};
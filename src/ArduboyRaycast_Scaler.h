@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduboy2.h>
+
+#include "ArduboyRaycast_Utils.h"
+
+// Precalculated wall scalers, in the spirit of Wolfenstein 3D's compiled scalers (see RCWALLSCALERS).
+// Stepping through a texture strip one pixel at a time costs the same no matter how few texels
+// there are, so tall walls (which are mostly the same texel repeated) are the most expensive to
+// draw. A scaler instead lists, for every screen page (8 rows) of a wall of one height, which bits
+// of that page each texel covers. A page is then a handful of "texel on: set these bits, texel
+// off: clear them" steps rather than 8 separately stepped pixels.
+//
+// Walls are quantized to their half height (same as calcWallLine), and centered on the middle of
+// the view. One scaler is a fixed RECORDBYTES long, so it can be found without an index:
+// - Texel at the top of the visible wall (more than 0 when the wall is taller than the view)
+// - For each page the wall touches, top to bottom:
+//   - Number of texels which start in this page (N)
+//   - Bits of this page covered by the texel continued from the page above (0 if none)
+//   - N bit masks, one per texel, in texel order
+// - Zero padding
+// Only walls at least as tall as the tile are supported, so every texel is at least one row and
+// they're always consecutive. The whole table is generated by the compiler, no tools required.
+
+#ifndef RCWALLSCALERBUDGET
+#define RCWALLSCALERBUDGET 1024
+#endif
+
+// Layout + compile time math for the scalers of a view H rows high with TileSize texel strips.
+// Everything here is constexpr and only runs in the compiler
+template<uint8_t H, uint8_t TileSize>
+struct RcWallScaler
+{
+    static constexpr uint8_t MIDSCREENY = H / 2;
+    static constexpr uint8_t RECORDBYTES = 1 + 2 * ((H + 7) >> 3) + TileSize;
+
+    // Visible rows of a wall with the given half height. End is exclusive
+    static constexpr int16_t yStart(uint8_t half) { return MIDSCREENY > half ? MIDSCREENY - half : 0; }
+    static constexpr int16_t yEnd(uint8_t half) { return MIDSCREENY + half < H ? MIDSCREENY + half : H; }
+
+    // Texel drawn on the given (visible) row
+    static constexpr uint8_t texel(uint8_t half, int16_t y)
+    {
+        return (uint8_t)(((y - (MIDSCREENY - (int16_t)half)) * TileSize) / (2 * half));
+    }
+
+    // Whether a new texel starts on this row (the first visible row always starts one)
+    static constexpr bool starts(uint8_t half, int16_t y)
+    {
+        return y == yStart(half) || texel(half, y) != texel(half, y - 1);
+    }
+
+    // Visible rows of the page
+    static constexpr int16_t pageStart(uint8_t half, uint8_t page) { return page * 8 > yStart(half) ? page * 8 : yStart(half); }
+    static constexpr int16_t pageEnd(uint8_t half, uint8_t page) { return page * 8 + 8 < yEnd(half) ? page * 8 + 8 : yEnd(half); }
+    static constexpr uint8_t lastPage(uint8_t half) { return (yEnd(half) - 1) >> 3; }
+
+    // Bits of rows [y, end) that the given texel covers
+    static constexpr uint8_t texelMask(uint8_t half, uint8_t t, int16_t y, int16_t end)
+    {
+        return y >= end ? 0 : ((texel(half, y) == t ? 1 << (y & 7) : 0) | texelMask(half, t, y + 1, end));
+    }
+
+    // Texels starting in rows [y, end)
+    static constexpr uint8_t startCount(uint8_t half, int16_t y, int16_t end)
+    {
+        return y >= end ? 0 : (starts(half, y) ? 1 : 0) + startCount(half, y + 1, end);
+    }
+
+    static constexpr uint8_t pageCount(uint8_t half, uint8_t page)
+    {
+        return startCount(half, pageStart(half, page), pageEnd(half, page));
+    }
+
+    static constexpr uint8_t pageCarry(uint8_t half, uint8_t page)
+    {
+        return starts(half, pageStart(half, page)) ? 0 :
+            texelMask(half, texel(half, pageStart(half, page)), pageStart(half, page), pageEnd(half, page));
+    }
+
+    // Byte k of the page's part of the record
+    static constexpr uint8_t pageByte(uint8_t half, uint8_t page, uint8_t k)
+    {
+        return k == 0 ? pageCount(half, page) :
+            k == 1 ? pageCarry(half, page) :
+            texelMask(half,
+                texel(half, pageStart(half, page)) + (pageCarry(half, page) ? 1 : 0) + (k - 2),
+                pageStart(half, page), pageEnd(half, page));
+    }
+
+    // Byte k of the record, starting from the given page
+    static constexpr uint8_t pagesByte(uint8_t half, uint8_t page, uint8_t k)
+    {
+        return page > lastPage(half) ? 0 :
+            k < 2 + pageCount(half, page) ? pageByte(half, page, k) :
+            pagesByte(half, page + 1, k - 2 - pageCount(half, page));
+    }
+
+    static constexpr uint8_t recordByte(uint8_t half, uint8_t k)
+    {
+        return k == 0 ? texel(half, yStart(half)) : pagesByte(half, yStart(half) >> 3, k - 1);
+    }
+
+    // Byte i of a table with scalers for every half height from MinHalf up
+    static constexpr uint8_t tableByte(uint8_t minHalf, uint16_t i)
+    {
+        return recordByte(minHalf + i / RECORDBYTES, i % RECORDBYTES);
+    }
+};
+
+// The scalers for every half height from MinHalf to MaxHalf, generated at compile time
+template<uint8_t H, uint8_t TileSize, uint8_t MinHalf, uint8_t MaxHalf,
+    typename Indices = typename RcMakeIndices<(MaxHalf - MinHalf + 1) * RcWallScaler<H, TileSize>::RECORDBYTES>::type>
+struct RcWallScalerTable;
+
+template<uint8_t H, uint8_t TileSize, uint8_t MinHalf, uint8_t MaxHalf, uint16_t... I>
+struct RcWallScalerTable<H, TileSize, MinHalf, MaxHalf, RcIndices<I...>>
+{
+    static_assert(2 * MinHalf >= TileSize, "Wall scalers need walls at least as tall as the tile");
+
+    static const uint8_t data[sizeof...(I)];
+};
+
+template<uint8_t H, uint8_t TileSize, uint8_t MinHalf, uint8_t MaxHalf, uint16_t... I>
+const uint8_t RcWallScalerTable<H, TileSize, MinHalf, MaxHalf, RcIndices<I...>>::data[sizeof...(I)] PROGMEM = {
+    RcWallScaler<H, TileSize>::tableByte(MinHalf, I)...
+};
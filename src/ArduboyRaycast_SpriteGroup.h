@@ -1,241 +1,477 @@
-#pragma once
-
-#include "ArduboyRaycast_Sprite.h"
-
-#define ISSPRITEACTIVE(s) (s.state & RSSTATEACTIVE)
-
-template<uint8_t InternalStateBytes>
-class RcSpriteGroup
-{
-public:
-    RcSprite<InternalStateBytes> * sprites;
-    SSprite<InternalStateBytes> * sortedSprites;
-    RcBounds * bounds;
-    uint8_t numsprites;
-    uint8_t numbounds;
-
-    RcSprite<InternalStateBytes> * operator[](uint8_t index)
-    {
-        return &this->sprites[index];
-    }
-
-    void resetSprites()
-    {
-        memset(this->sprites, 0, sizeof(RcSprite<InternalStateBytes>) * this->numsprites);
-    }
-
-    void resetBounds()
-    {
-        memset(this->bounds, 0, sizeof(RcBounds) * this->numbounds);
-    }
-
-    void resetAll()
-    {
-        this->resetBounds();
-        this->resetSprites();
-    }
-
-    void runSprites()
-    {
-        uint8_t numsprites = this->numsprites;
-        for(uint8_t i = 0; i < numsprites; i++)
-        {
-            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
-            if(!ISSPRITEACTIVE((*sprite)))
-                continue;
-            
-            if(sprite->behavior)
-                sprite->behavior(sprite);
-        }
-    }
-
-    // Run a common function against all active sprites.
-    void runSpritesCommon(void (* func)(RcSprite<InternalStateBytes> *))
-    {
-        uint8_t numsprites = this->numsprites;
-        for(uint8_t i = 0; i < numsprites; i++)
-        {
-            if(this->sprites[i].isActive())
-                func(&this->sprites[i]);    
-        }
-    }
-
-    //Sort sprites within the sprite contiainer (only affects the sorted list). returns number of active sprites
-    uint8_t sortSprites(uflot playerX, uflot playerY)
-    {
-        SFixed<11,4> fposx = (SFixed<11,4>)playerX;
-        SFixed<11,4> fposy = (SFixed<11,4>)playerY;
-
-        //Make a temp sort array on stack
-        uint8_t numsprites = this->numsprites;
-        uint8_t usedSprites = 0;
-        SSprite<InternalStateBytes> * sorted = this->sortedSprites;
-        
-        // Calc distance. Also, sort elements (might as well, we're already here)
-        for (uint8_t i = 0; i < numsprites; ++i)
-        {
-            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
-
-            if (!ISSPRITEACTIVE((*sprite)))
-                continue;
-
-            SSprite<InternalStateBytes> toSort;
-            SFixed<11,4> dpx = (SFixed<11,4>)sprite->x - fposx;
-            SFixed<11,4> dpy = (SFixed<11,4>)sprite->y - fposy;
-            toSort.distance = dpx * dpx + dpy * dpy; // sqrt not taken, unneeded
-            toSort.sprite = sprite;
-
-            //Insertion sort (it's faster for small arrays; if you increase sprite count to some 
-            //absurd number, change this to something else).
-            int8_t insertPos = usedSprites - 1;
-
-            while(insertPos >= 0 && sorted[insertPos].distance < toSort.distance)
-            {
-                sorted[insertPos + 1] = sorted[insertPos];
-                insertPos--;
-            }
-
-            sorted[insertPos + 1] = toSort;
-            usedSprites++;
-        }
-
-        return usedSprites;
-    }
-
-    // Attempt to add a sprite to the sprite list. Activates the sprite immediately and fills out some of the more 
-    // complicated fields.
-    RcSprite<InternalStateBytes> * addSprite(muflot x, muflot y, uint8_t frame, uint8_t sizeLevel, int8_t heightAdjust, void (* func)(RcSprite<InternalStateBytes> *))
-    {
-        uint8_t numsprites = this->numsprites;
-        for(uint8_t i = 0; i < numsprites; i++)
-        {
-            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
-            if(!ISSPRITEACTIVE((*sprite)))
-            {
-                sprite->x = x; //muflot(x);
-                sprite->y = y; //muflot(y);
-                sprite->frame = frame;
-                sprite->setActive(true);
-                sprite->setHeight(heightAdjust);
-                sprite->setSizeIndex(sizeLevel);
-                sprite->behavior = func;
-                return sprite;
-            }
-        }
-
-        return NULL;
-    }
-
-    // Attempt to add a bounds to the bounds list.
-    RcBounds * addBounds(muflot x1, muflot y1, muflot x2, muflot y2, bool solid)
-    {
-        uint8_t numbounds = this->numbounds;
-        for(uint8_t i = 0; i < numbounds; i++)
-        {
-            RcBounds * bounds = &this->bounds[i];
-            if(!ISSPRITEACTIVE((*bounds)))
-            {
-                bounds->x1 = x1; //muflot(x1);
-                bounds->x2 = x2; //muflot(x2);
-                bounds->y1 = y1; //muflot(y1);
-                bounds->y2 = y2; //muflot(y2);
-                bounds->setActive(true);
-                bounds->setSolid(solid);
-                return bounds;
-            }
-        }
-
-        return NULL;
-    }
-
-    // A shortcut function to add simple square bounds around the sprite and link the two together.
-    // It is equivalent to calling 'addBounds' then calling 'linkSpriteBounds' with all the error
-    // handling involved. Not that linked bounds do NOT move with the sprite, that's up to you.
-    // Linking is only done to more easily find a sprite from a bounds, and vice-versa.
-    RcBounds * addSpriteBounds(RcSprite<InternalStateBytes> * sprite, muflot size, bool solid)
-    {
-        muflot halfsize = size / 2;
-        RcBounds * result = this->addBounds(sprite->x - halfsize, sprite->y - halfsize, sprite->x + halfsize, sprite->y + halfsize, solid);
-        if(result)
-        {
-            RcBounds * bounds = this->linkSpriteBounds(sprite, result);
-            if(bounds == NULL)
-            {
-                this->deleteBounds(result);
-                result = NULL;
-            }
-            else
-            {
-                result = bounds;
-            }
-        }
-        return result;
-    }
-
-    // Link a sprite and bounds together. This is only an "imaginary" link for use with finding sprites
-    // based on bounds, and does not impact anything else in the library. For instance, you still
-    // need to delete both sprite and bounds separately. This is a relatively expensive function
-    // (for these low powered systems), only call this when creating sprites! NO safety checks are
-    // performed; if you pass in a sprite or bounds that are not contained within this group, the
-    // results are undefined (and almost certainly broken!)
-    RcBounds * linkSpriteBounds(RcSprite<InternalStateBytes> * sprite, RcBounds * bounds)
-    {
-        uint8_t spriteIndex = sprite - this->sprites;
-        uint8_t oldBoundsIndex = bounds - this->bounds;
-        if(spriteIndex == oldBoundsIndex) return bounds;    // Already linked
-        if(this->numbounds <= spriteIndex) return NULL;     // Not enough space to 'link' the bounds
-        RcBounds existing = this->bounds[spriteIndex];
-        this->bounds[spriteIndex] = this->bounds[oldBoundsIndex];
-        this->bounds[oldBoundsIndex] = existing;
-        return &this->bounds[spriteIndex];
-    }
-
-    // If a sprite is linked to a bounds, get the sprite from the bounds. Note that the 
-    // functionality is undefined if the sprite + bounds are not linked (no check is performed)
-    RcSprite<InternalStateBytes> * getLinkedSprite(RcBounds * bounds)
-    {
-        return &this->sprites[bounds - this->bounds];
-    }
-
-    // If a sprite is linked to a bounds, get the bounds from the sprite. Note that 
-    // the functionality is undefined if the sprite + bounds are not linked
-    RcBounds * getLinkedBounds(RcSprite<InternalStateBytes> * sprite)
-    {
-        return &this->bounds[sprite - this->sprites];
-    }
-
-    void deleteBounds(RcBounds * bounds) { bounds->state = 0; }
-    void deleteSprite(RcSprite<InternalStateBytes> * sprite) { sprite->state = 0; }
-    void deleteLinked(RcBounds * bounds) {
-        RcSprite<InternalStateBytes> * sprite = this->getLinkedSprite(bounds);
-        this->deleteSprite(sprite);
-        this->deleteBounds(bounds);
-    }
-    void deleteLinked(RcSprite<InternalStateBytes> * sprite) {
-        RcBounds * bounds = this->getLinkedBounds(sprite);
-        this->deleteSprite(sprite);
-        this->deleteBounds(bounds);
-    }
-
-    //Get the first bounding box (in order of ID) which intersects this point. Optionally restrict 
-    //by bounds that have a nonzero value with the statemask
-    RcBounds * firstColliding(uflot x, uflot y, uint8_t statemask)
-    {
-        uint8_t numbounds = this->numbounds;
-        for (uint8_t i = 0; i < numbounds; i++)
-        {
-            if (!ISSPRITEACTIVE((this->bounds[i])))
-                continue;
-
-            if(!statemask || (this->bounds[i].state & statemask))
-            {
-                if(this->bounds[i].colliding(x, y))
-                    return &this->bounds[i];
-            }
-        }
-
-        return NULL;
-    }
-};
-
-
+#pragma once
+
+#include "ArduboyRaycast_Sprite.h"
+#include "ArduboyRaycast_Map.h"
+
+#define ISSPRITEACTIVE(s) (s.state & RSSTATEACTIVE)
+
+// Available flags for compilation
+// #define RCBOUNDSINDEX          // Index bounds by map row + column so firstColliding only tests bounds near the point. Costs 128 bytes RAM
+
+#ifdef RCBOUNDSINDEX
+// Bounds are indexed with one bit per bounds, so only this many are indexed. Any bounds past this 
+// are still checked, just with the regular linear scan. With 64 small bounds spread over the map, 
+// firstColliding was about 2.7x faster than without the index (extras/bench/test_bounds, host)
+constexpr uint8_t RCBOUNDSINDEXED = 32;
+typedef uint32_t rcboundsmask;
+#endif
+
+// A sprite "culler" which lets everything through. See RcSpriteCuller
+struct RcNoCull
+{
+    template<uint8_t InternalStateBytes>
+    inline bool visible(RcSprite<InternalStateBytes> *) { return true; }
+};
+
+// Rejects sprites which can't possibly be drawn, before they're sorted (which is O(n^2)) and 
+// projected (which is float heavy). The renderers fill this out once per frame in drawSprites.
+// A sprite is rejected if it's behind the camera or too close, too far away, fully outside the
+// view frustum, or hidden behind walls in every column it covers. The tests use the same math as 
+// calcSpriteDraw + the drawing depth test, so culling should never change what's on screen
+// (except the view distance, which is only used when sprites are shaded into darkness anyway).
+template<uint8_t W, uint8_t H>
+struct RcSpriteCuller
+{
+    float posX;
+    float posY;
+    float dirX;
+    float dirY;
+    float invDet;
+    float minDepth;
+    float maxDepth;         // 0 means don't check
+    const muflot * scaling; // The renderer's spritescaling
+    const uflot * distCache;
+
+    template<uint8_t InternalStateBytes>
+    bool visible(RcSprite<InternalStateBytes> * sprite)
+    {
+        float spriteX = (float)sprite->x - this->posX;
+        float spriteY = (float)sprite->y - this->posY;
+
+        // Behind us (or too close), or too far
+        float depth = this->invDet * (this->dirX * spriteX + this->dirY * spriteY);
+        if(depth < this->minDepth || (this->maxDepth && depth > this->maxDepth))
+            return false;
+
+        // The camera plane is the same length as the direction, so the edges of the frustum are
+        // where |side| == depth. Sprites are as wide as they are tall, which in camera units is
+        // scale * H / W either side of the center. Allow a couple extra pixels for rounding on the edges
+        float side = this->invDet * (this->dirY * spriteX - this->dirX * spriteY);
+        float scale = (float)this->scaling[(sprite->state & RSSTATESIZE) >> 1];
+        if(abs(side) > depth * (1 + 4.0f / W) + scale * H / W)
+            return false;
+
+        // Everything in range is on screen (at least partially); find the columns it covers. Widen
+        // the range a bit, it doesn't matter if we let a few hidden sprites through
+        float invDepth = 1 / depth;
+        int16_t center = int16_t((W >> 1) * (1 + side * invDepth));
+        int16_t half = (int16_t(H * invDepth * scale) >> 1) + 2;
+        int16_t start = max(center - half, 0);
+        int16_t end = min(center + half, (int16_t)W);
+
+        // Sprites are drawn per column if they're closer than the wall there. The cache only has 
+        // every other column, which is also what drawing uses
+        uflot fixedDepth = (uflot)depth;
+        for(int16_t x = start & ~1; x < end; x += 2)
+            if(fixedDepth < this->distCache[x >> 1])
+                return true;
+
+        return false;
+    }
+};
+
+template<uint8_t InternalStateBytes>
+class RcSpriteGroup
+{
+public:
+    RcSprite<InternalStateBytes> * sprites;
+    SSprite<InternalStateBytes> * sortedSprites;
+    RcBounds * bounds;
+    uint8_t numsprites;
+    uint8_t numbounds;
+
+    #ifdef RCBOUNDSINDEX
+    // For each map row (and column), which bounds overlap it. A point can then only collide with 
+    // bounds in both its row and its column mask. Sprite coordinates can't go past 16, so neither can this
+    rcboundsmask boundsRows[RCMAXMAPDIMENSION];
+    rcboundsmask boundsColumns[RCMAXMAPDIMENSION];
+    #endif
+
+    RcSprite<InternalStateBytes> * operator[](uint8_t index)
+    {
+        return &this->sprites[index];
+    }
+
+    void resetSprites()
+    {
+        memset((void *)this->sprites, 0, sizeof(RcSprite<InternalStateBytes>) * this->numsprites);
+    }
+
+    void resetBounds()
+    {
+        memset((void *)this->bounds, 0, sizeof(RcBounds) * this->numbounds);
+        #ifdef RCBOUNDSINDEX
+        memset(this->boundsRows, 0, sizeof(this->boundsRows));
+        memset(this->boundsColumns, 0, sizeof(this->boundsColumns));
+        #endif
+    }
+
+    void resetAll()
+    {
+        this->resetBounds();
+        this->resetSprites();
+    }
+
+    void runSprites()
+    {
+        uint8_t numsprites = this->numsprites;
+        for(uint8_t i = 0; i < numsprites; i++)
+        {
+            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
+            if(!ISSPRITEACTIVE((*sprite)))
+                continue;
+            
+            if(sprite->behavior)
+                sprite->behavior(sprite);
+        }
+    }
+
+    // Run a common function against all active sprites.
+    void runSpritesCommon(void (* func)(RcSprite<InternalStateBytes> *))
+    {
+        uint8_t numsprites = this->numsprites;
+        for(uint8_t i = 0; i < numsprites; i++)
+        {
+            if(this->sprites[i].isActive())
+                func(&this->sprites[i]);    
+        }
+    }
+
+    // A cheap checksum of everything about the active sprites that affects how they're drawn
+    // (position, frame and state). Useful for detecting whether the sprites changed at all
+    uint16_t drawHash()
+    {
+        uint16_t hash = 0;
+        uint8_t numsprites = this->numsprites;
+        for(uint8_t i = 0; i < numsprites; i++)
+        {
+            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
+            if(!ISSPRITEACTIVE((*sprite)))
+                continue;
+            hash = (hash << 3 | hash >> 13) ^ i;
+            hash = (hash << 3 | hash >> 13) ^ sprite->x.getInternal();
+            hash = (hash << 3 | hash >> 13) ^ sprite->y.getInternal();
+            hash = (hash << 3 | hash >> 13) ^ sprite->frame;
+            hash = (hash << 3 | hash >> 13) ^ sprite->state;
+        }
+        return hash;
+    }
+
+    //Sort sprites within the sprite contiainer (only affects the sorted list). returns number of active sprites
+    inline uint8_t sortSprites(uflot playerX, uflot playerY)
+    {
+        RcNoCull culler;
+        return this->sortSprites(playerX, playerY, &culler);
+    }
+
+    //Sort only the sprites which the culler says are visible (see RcSpriteCuller). Returns the number sorted
+    template<typename Culler>
+    uint8_t sortSprites(uflot playerX, uflot playerY, Culler * culler)
+    {
+        SFixed<11,4> fposx = (SFixed<11,4>)playerX;
+        SFixed<11,4> fposy = (SFixed<11,4>)playerY;
+
+        //Make a temp sort array on stack
+        uint8_t numsprites = this->numsprites;
+        uint8_t usedSprites = 0;
+        SSprite<InternalStateBytes> * sorted = this->sortedSprites;
+        
+        // Calc distance. Also, sort elements (might as well, we're already here)
+        for (uint8_t i = 0; i < numsprites; ++i)
+        {
+            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
+
+            if (!ISSPRITEACTIVE((*sprite)) || !culler->visible(sprite))
+                continue;
+
+            SSprite<InternalStateBytes> toSort;
+            SFixed<11,4> dpx = (SFixed<11,4>)sprite->x - fposx;
+            SFixed<11,4> dpy = (SFixed<11,4>)sprite->y - fposy;
+            toSort.distance = dpx * dpx + dpy * dpy; // sqrt not taken, unneeded
+            toSort.sprite = sprite;
+
+            //Insertion sort (it's faster for small arrays; if you increase sprite count to some 
+            //absurd number, change this to something else).
+            int8_t insertPos = usedSprites - 1;
+
+            while(insertPos >= 0 && sorted[insertPos].distance < toSort.distance)
+            {
+                sorted[insertPos + 1] = sorted[insertPos];
+                insertPos--;
+            }
+
+            sorted[insertPos + 1] = toSort;
+            usedSprites++;
+        }
+
+        return usedSprites;
+    }
+
+    // Attempt to add a sprite to the sprite list. Activates the sprite immediately and fills out some of the more 
+    // complicated fields.
+    RcSprite<InternalStateBytes> * addSprite(muflot x, muflot y, uint8_t frame, uint8_t sizeLevel, int8_t heightAdjust, void (* func)(RcSprite<InternalStateBytes> *))
+    {
+        uint8_t numsprites = this->numsprites;
+        for(uint8_t i = 0; i < numsprites; i++)
+        {
+            RcSprite<InternalStateBytes> * sprite = &this->sprites[i];
+            if(!ISSPRITEACTIVE((*sprite)))
+            {
+                sprite->x = x; //muflot(x);
+                sprite->y = y; //muflot(y);
+                sprite->frame = frame;
+                sprite->setActive(true);
+                sprite->setHeight(heightAdjust);
+                sprite->setSizeIndex(sizeLevel);
+                sprite->behavior = func;
+                return sprite;
+            }
+        }
+
+        return NULL;
+    }
+
+    // Attempt to add a bounds to the bounds list.
+    RcBounds * addBounds(muflot x1, muflot y1, muflot x2, muflot y2, bool solid)
+    {
+        uint8_t numbounds = this->numbounds;
+        for(uint8_t i = 0; i < numbounds; i++)
+        {
+            RcBounds * bounds = &this->bounds[i];
+            if(!ISSPRITEACTIVE((*bounds)))
+            {
+                bounds->x1 = x1; //muflot(x1);
+                bounds->x2 = x2; //muflot(x2);
+                bounds->y1 = y1; //muflot(y1);
+                bounds->y2 = y2; //muflot(y2);
+                bounds->setActive(true);
+                bounds->setSolid(solid);
+                this->indexBounds(i);
+                return bounds;
+            }
+        }
+
+        return NULL;
+    }
+
+    // A shortcut function to add simple square bounds around the sprite and link the two together.
+    // It is equivalent to calling 'addBounds' then calling 'linkSpriteBounds' with all the error
+    // handling involved. Not that linked bounds do NOT move with the sprite, that's up to you.
+    // Linking is only done to more easily find a sprite from a bounds, and vice-versa.
+    RcBounds * addSpriteBounds(RcSprite<InternalStateBytes> * sprite, muflot size, bool solid)
+    {
+        muflot halfsize = size / 2;
+        RcBounds * result = this->addBounds(sprite->x - halfsize, sprite->y - halfsize, sprite->x + halfsize, sprite->y + halfsize, solid);
+        if(result)
+        {
+            RcBounds * bounds = this->linkSpriteBounds(sprite, result);
+            if(bounds == NULL)
+            {
+                this->deleteBounds(result);
+                result = NULL;
+            }
+            else
+            {
+                result = bounds;
+            }
+        }
+        return result;
+    }
+
+    // Link a sprite and bounds together. This is only an "imaginary" link for use with finding sprites
+    // based on bounds, and does not impact anything else in the library. For instance, you still
+    // need to delete both sprite and bounds separately. This is a relatively expensive function
+    // (for these low powered systems), only call this when creating sprites! NO safety checks are
+    // performed; if you pass in a sprite or bounds that are not contained within this group, the
+    // results are undefined (and almost certainly broken!)
+    RcBounds * linkSpriteBounds(RcSprite<InternalStateBytes> * sprite, RcBounds * bounds)
+    {
+        uint8_t spriteIndex = sprite - this->sprites;
+        uint8_t oldBoundsIndex = bounds - this->bounds;
+        if(spriteIndex == oldBoundsIndex) return bounds;    // Already linked
+        if(this->numbounds <= spriteIndex) return NULL;     // Not enough space to 'link' the bounds
+        this->unindexBounds(spriteIndex);
+        this->unindexBounds(oldBoundsIndex);
+        RcBounds existing = this->bounds[spriteIndex];
+        this->bounds[spriteIndex] = this->bounds[oldBoundsIndex];
+        this->bounds[oldBoundsIndex] = existing;
+        this->indexBounds(spriteIndex);
+        this->indexBounds(oldBoundsIndex);
+        return &this->bounds[spriteIndex];
+    }
+
+    // If a sprite is linked to a bounds, get the sprite from the bounds. Note that the 
+    // functionality is undefined if the sprite + bounds are not linked (no check is performed)
+    RcSprite<InternalStateBytes> * getLinkedSprite(RcBounds * bounds)
+    {
+        return &this->sprites[bounds - this->bounds];
+    }
+
+    // If a sprite is linked to a bounds, get the bounds from the sprite. Note that 
+    // the functionality is undefined if the sprite + bounds are not linked
+    RcBounds * getLinkedBounds(RcSprite<InternalStateBytes> * sprite)
+    {
+        return &this->bounds[sprite - this->sprites];
+    }
+
+    void deleteBounds(RcBounds * bounds) { 
+        this->unindexBounds(bounds - this->bounds);
+        bounds->state = 0; 
+    }
+    void deleteSprite(RcSprite<InternalStateBytes> * sprite) { sprite->state = 0; }
+    void deleteLinked(RcBounds * bounds) {
+        RcSprite<InternalStateBytes> * sprite = this->getLinkedSprite(bounds);
+        this->deleteSprite(sprite);
+        this->deleteBounds(bounds);
+    }
+    void deleteLinked(RcSprite<InternalStateBytes> * sprite) {
+        RcBounds * bounds = this->getLinkedBounds(sprite);
+        this->deleteSprite(sprite);
+        this->deleteBounds(bounds);
+    }
+
+    // Move a bounds to a new location. If you change a bounds' position directly instead, call
+    // unindexBounds before and indexBounds after (or reindexBounds once if you changed many), 
+    // otherwise RCBOUNDSINDEX won't find it in its new location
+    void moveBounds(RcBounds * bounds, muflot x1, muflot y1, muflot x2, muflot y2)
+    {
+        uint8_t index = bounds - this->bounds;
+        this->unindexBounds(index);
+        bounds->x1 = x1;
+        bounds->y1 = y1;
+        bounds->x2 = x2;
+        bounds->y2 = y2;
+        this->indexBounds(index);
+    }
+
+    // Add a single bounds (by ID) to the collision index, over the cells it currently covers. 
+    // Does nothing without RCBOUNDSINDEX
+    void indexBounds(uint8_t index)
+    {
+        #ifdef RCBOUNDSINDEX
+        if(index >= RCBOUNDSINDEXED || !ISSPRITEACTIVE(this->bounds[index]))
+            return;
+        this->setBoundsBits(index, true);
+        #else
+        (void)index;
+        #endif
+    }
+
+    // Remove a single bounds (by ID) from the collision index, over the cells it currently covers. 
+    // Only those rows and columns are touched, so call this BEFORE changing its position. Anything 
+    // left behind only costs time: firstColliding still checks every bounds the index gives it
+    void unindexBounds(uint8_t index)
+    {
+        #ifdef RCBOUNDSINDEX
+        if(index >= RCBOUNDSINDEXED)
+            return;
+        this->setBoundsBits(index, false);
+        #else
+        (void)index;
+        #endif
+    }
+
+    // Rebuild the whole collision index, for if you've moved many bounds directly. Also clears out 
+    // anything left behind by bounds changed without unindexBounds
+    void reindexBounds()
+    {
+        #ifdef RCBOUNDSINDEX
+        memset(this->boundsRows, 0, sizeof(this->boundsRows));
+        memset(this->boundsColumns, 0, sizeof(this->boundsColumns));
+        uint8_t numbounds = min(this->numbounds, RCBOUNDSINDEXED);
+        for(uint8_t i = 0; i < numbounds; i++)
+            this->indexBounds(i);
+        #endif
+    }
+
+    //Get the first bounding box (in order of ID) which intersects this point. Optionally restrict 
+    //by bounds that have a nonzero value with the statemask
+    RcBounds * firstColliding(uflot x, uflot y, uint8_t statemask)
+    {
+        uint8_t numbounds = this->numbounds;
+        uint8_t i = 0;
+
+        #ifdef RCBOUNDSINDEX
+        uint8_t cellX = x.getInteger();
+        uint8_t cellY = y.getInteger();
+        rcboundsmask candidates = 0;
+        if(cellX < RCMAXMAPDIMENSION && cellY < RCMAXMAPDIMENSION)
+            candidates = this->boundsRows[cellY] & this->boundsColumns[cellX];
+
+        // Only visit the bounds whose bits are set, still in order of ID
+        for(; candidates; i++, candidates >>= 1)
+        {
+            if(!(candidates & 1))
+            {
+                if(!(candidates & 0xFF))
+                {
+                    // Skip a whole empty byte at once (candidates is non zero, so this terminates)
+                    i += 7;
+                    candidates >>= 7;
+                }
+                continue;
+            }
+
+            // Same tests as the linear scan below; the index can have bounds which have since been
+            // deactivated or moved directly
+            if (!ISSPRITEACTIVE((this->bounds[i])))
+                continue;
+
+            if(!statemask || (this->bounds[i].state & statemask))
+            {
+                if(this->bounds[i].colliding(x, y))
+                    return &this->bounds[i];
+            }
+        }
+
+        // Anything past the indexed bounds still needs the linear scan
+        i = RCBOUNDSINDEXED;
+        #endif
+
+        for (; i < numbounds; i++)
+        {
+            if (!ISSPRITEACTIVE((this->bounds[i])))
+                continue;
+
+            if(!statemask || (this->bounds[i].state & statemask))
+            {
+                if(this->bounds[i].colliding(x, y))
+                    return &this->bounds[i];
+            }
+        }
+
+        return NULL;
+    }
+
+private:
+    #ifdef RCBOUNDSINDEX
+    // Set or clear a bounds' bit in the rows + columns it covers. Colliding is exclusive on the 
+    // edges, so a bounds ending exactly on a cell edge doesn't need that cell. Including it anyway 
+    // is simpler and only costs an extra check
+    void setBoundsBits(uint8_t index, bool set)
+    {
+        RcBounds * bounds = &this->bounds[index];
+        rcboundsmask bit = (rcboundsmask)1 << index;
+        rcboundsmask keep = set ? ~(rcboundsmask)0 : ~bit;
+        rcboundsmask add = set ? bit : 0;
+        uint8_t x2 = min(bounds->x2.getInteger(), (uint8_t)(RCMAXMAPDIMENSION - 1));
+        uint8_t y2 = min(bounds->y2.getInteger(), (uint8_t)(RCMAXMAPDIMENSION - 1));
+        for(uint8_t i = bounds->x1.getInteger(); i <= x2; i++)
+            this->boundsColumns[i] = (this->boundsColumns[i] & keep) | add;
+        for(uint8_t i = bounds->y1.getInteger(); i <= y2; i++)
+            this->boundsRows[i] = (this->boundsRows[i] & keep) | add;
+    }
+    #endif
+};
+
+